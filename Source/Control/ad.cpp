@@ -1,5 +1,6 @@
 #include "ad.h"
 #include <math.h>
+#include "dsp.h"
 
 using namespace daisysp;
 
@@ -52,7 +53,7 @@ void Ad::SetAttackTime(float timeInS, float shape)
             float target    = 9.f * powf(x, 10.f) + 0.3f * x + 1.01f;
             attackTarget_   = target;
             float logTarget = logf(1.f - (1.f / target)); // -1 for decay
-            attackD0_       = 1.f - expf(logTarget / (timeInS * sample_rate_));
+            attackD0_       = 1.f - LutExp(logTarget / (timeInS * sample_rate_));
         }
         else
             attackD0_ = 1.f; // instant change
@@ -73,7 +74,7 @@ void Ad::SetTimeConstant(float timeInS, float& time, float& coeff)
         if(time > 0.f)
         {
             const float target = logf(1. / M_E);
-            coeff              = 1.f - expf(target / (time * sample_rate_));
+            coeff              = 1.f - LutExp(target / (time * sample_rate_));
         }
         else
             coeff = 1.f; // instant change
@@ -116,3 +117,11 @@ float Ad::Process()
     }
     return out;
 }
+
+void Ad::Render(float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process();
+    }
+}
@@ -3,6 +3,7 @@
 #define ADE_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -48,6 +49,11 @@ class Ade
         \param gate - trigger the envelope, hold it to sustain 
     */
     float Process();
+    /** Renders a block of the envelope, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float *out, size_t size);
     /** Sets time
         Set time per segment in seconds
     */
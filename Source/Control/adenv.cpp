@@ -50,6 +50,8 @@ void AdEnv::Init(float sample_rate)
 {
     sample_rate_     = sample_rate;
     current_segment_ = ADENV_SEG_IDLE;
+    prev_segment_    = ADENV_SEG_IDLE;
+    trigger_         = 0;
     curve_scalar_    = 0.0f; // full linear
     phase_           = 0;
     min_             = 0.0f;
@@ -155,3 +157,11 @@ float AdEnv::Process()
 
     return out * (max_ - min_) + min_;
 }
+
+void AdEnv::Render(float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process();
+    }
+}
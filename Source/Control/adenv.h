@@ -2,6 +2,7 @@
 #ifndef ADENV_H
 #define ADENV_H
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -52,6 +53,26 @@ class AdEnv
     */
     float Process();
 
+    /** Renders a block of the envelope, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float *out, size_t size);
+
+    /** Renders a block, same as calling Trigger() first if trigger is set
+        and then Render(out, size). Lets RenderTriggered() start the
+        envelope at any sample of a block.
+        \param trigger - starts or retriggers the envelope
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(bool trigger, float *out, size_t size)
+    {
+        if(trigger)
+            Trigger();
+        Render(out, size);
+    }
+
     /** Starts or retriggers the envelope.*/
     inline void Trigger() { trigger_ = 1; }
     /** Sets the length of time (in seconds) for a specific segment. */
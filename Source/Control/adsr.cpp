@@ -1,5 +1,6 @@
 #include "adsr.h"
 #include <math.h>
+#include "dsp.h"
 
 using namespace daisysp;
 
@@ -60,7 +61,7 @@ void Adsr::SetAttackTime(float timeInS, float shape)
             float target    = 9.f * powf(x, 10.f) + 0.3f * x + 1.01f;
             attackTarget_   = target;
             float logTarget = logf(1.f - (1.f / target)); // -1 for decay
-            attackD0_       = 1.f - expf(logTarget / (timeInS * sample_rate_));
+            attackD0_       = 1.f - LutExp(logTarget / (timeInS * sample_rate_));
         }
         else
             attackD0_ = 1.f; // instant change
@@ -84,7 +85,7 @@ void Adsr::SetTimeConstant(float timeInS, float& time, float& coeff)
         if(time > 0.f)
         {
             const float target = logf(1. / M_E);
-            coeff              = 1.f - expf(target / (time * sample_rate_));
+            coeff              = 1.f - LutExp(target / (time * sample_rate_));
         }
         else
             coeff = 1.f; // instant change
@@ -134,3 +135,70 @@ float Adsr::Process(bool gate)
     }
     return out;
 }
+
+void Adsr::Render(bool gate, float* out, size_t size)
+{
+    if(gate && !gate_) // rising edge
+        mode_ = ADSR_SEG_ATTACK;
+    else if(!gate && gate_) // falling edge
+        mode_ = ADSR_SEG_RELEASE;
+    gate_ = gate;
+
+    float   x    = x_;
+    uint8_t mode = mode_;
+    size_t  i    = 0;
+
+    // Each segment runs in its own tight loop until it hands over to the next.
+    while(i < size)
+    {
+        switch(mode)
+        {
+            case ADSR_SEG_ATTACK:
+            {
+                const float d0     = attackD0_;
+                const float target = attackTarget_;
+                while(i < size)
+                {
+                    x += d0 * (target - x);
+                    if(x > 1.f)
+                    {
+                        x        = 1.f;
+                        out[i++] = x;
+                        mode     = ADSR_SEG_DECAY;
+                        break;
+                    }
+                    out[i++] = x;
+                }
+            }
+            break;
+            case ADSR_SEG_DECAY:
+            case ADSR_SEG_RELEASE:
+            {
+                const float d0
+                    = mode == ADSR_SEG_DECAY ? decayD0_ : releaseD0_;
+                const float target
+                    = mode == ADSR_SEG_DECAY ? sus_level_ : -0.01f;
+                while(i < size)
+                {
+                    x += d0 * (target - x);
+                    if(x < 0.f)
+                    {
+                        x        = 0.f;
+                        out[i++] = x;
+                        mode     = ADSR_SEG_IDLE;
+                        break;
+                    }
+                    out[i++] = x;
+                }
+            }
+            break;
+            default:
+                while(i < size)
+                    out[i++] = 0.f;
+                break;
+        }
+    }
+
+    x_    = x;
+    mode_ = mode;
+}
@@ -3,6 +3,7 @@
 #define DSY_ADSR_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -48,6 +49,13 @@ class Adsr
         \param gate - trigger the envelope, hold it to sustain 
     */
     float Process(bool gate);
+    /** Renders a block of the envelope with the gate held for the whole block.
+        Equivalent to calling Process(gate) size times.
+        \param gate - trigger the envelope, hold it to sustain
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(bool gate, float* out, size_t size);
     /** Sets time
         Set time per segment in seconds
     */
@@ -1,5 +1,6 @@
 #include "dec.h"
 #include <math.h>
+#include "dsp.h"
 
 using namespace daisysp;
 
@@ -46,7 +47,7 @@ void Dec::SetTimeConstant(float timeInS, float& time, float& coeff)
         if(time > 0.f)
         {
             const float target = logf(1. / M_E);
-            coeff              = 1.f - expf(target / (time * sample_rate_));
+            coeff              = 1.f - LutExp(target / (time * sample_rate_));
         }
         else
             coeff = 1.f; // instant change
@@ -77,3 +78,11 @@ float Dec::Process()
     }
     return out;
 }
+
+void Dec::Render(float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process();
+    }
+}
@@ -39,3 +39,32 @@ float Line::Process(uint8_t *finished)
     *finished = finished_;
     return out;
 }
+
+void Line::Render(float *out, size_t size, uint8_t *finished)
+{
+    const float inc    = inc_;
+    const float end    = end_;
+    const bool  rising = end_ > start_;
+    const bool  fall   = end_ < start_;
+    float       val    = val_;
+    size_t      i      = 0;
+
+    while(i < size && !finished_)
+    {
+        if((rising && val >= end) || (fall && val <= end))
+        {
+            finished_ = 1;
+            val       = end;
+            break;
+        }
+        out[i++] = val;
+        val += inc;
+    }
+    for(; i < size; i++)
+    {
+        out[i] = val;
+    }
+
+    val_      = val;
+    *finished = finished_;
+}
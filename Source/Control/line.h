@@ -2,6 +2,7 @@
 #ifndef LINE_H
 #define LINE_H
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -22,6 +23,13 @@ class Line
     */
     float Process(uint8_t *finished);
 
+    /** Renders a block of the Line segment, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+        \param finished - updated to 1 once the Line's trajectory has completed.
+    */
+    void Render(float *out, size_t size, uint8_t *finished);
+
     /** Begin creation of Line. 
         \param start - beginning value
         \param end - ending value
@@ -32,3 +32,28 @@ float Phasor::Process()
     }
     return out;
 }
+
+void Phasor::Render(float *out, size_t size)
+{
+    const float inc   = inc_;
+    float       phase = phase_;
+    bool        eoc   = false;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = phase * TWO_PI_RECIP;
+        phase += inc;
+        if(phase > TWOPI_F)
+        {
+            phase -= TWOPI_F;
+            eoc = true;
+        }
+        if(phase < 0.0f)
+        {
+            phase = 0.0f;
+        }
+    }
+
+    phase_ = phase;
+    eoc_   = eoc;
+}
@@ -3,6 +3,7 @@
 #define DSY_PHASOR_H
 #ifdef __cplusplus
 
+#include <stddef.h>
 #include "Utility/dsp.h"
 
 namespace daisysp
@@ -47,6 +48,13 @@ class Phasor
     */
     float Process();
 
+    /** Renders a block of the Phasor, equivalent to calling Process() size times.
+        After the call IsEOC() reports whether a cycle ended within the block.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float *out, size_t size);
+
 
     /** Sets frequency of the Phasor in Hz
     */
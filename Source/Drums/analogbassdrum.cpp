@@ -47,6 +47,16 @@ inline float AnalogBassDrum::Diode(float x)
     }
 }
 
+void AnalogBassDrum::Update()
+{
+    scale_ = 0.001f / f0_;
+    q_     = 1500.0f * powf(2.f, kOneTwelfth * decay_ * 80.0f);
+    tone_f_
+        = fmin(4.0f * f0_ * powf(2.f, kOneTwelfth * tone_ * 108.0f), 1.0f);
+    exciter_leak_ = 0.08f * (tone_ + 0.25f);
+    dirty_        = false;
+}
+
 float AnalogBassDrum::Process(bool trigger)
 {
     const int kTriggerPulseDuration  = static_cast<int>(1.0e-3f * sample_rate_);
@@ -55,11 +65,14 @@ float AnalogBassDrum::Process(bool trigger)
     const float kPulseFilterTime     = 0.1e-3f * sample_rate_;
     const float kRetrigPulseDuration = 0.05f * sample_rate_;
 
-    const float scale = 0.001f / f0_;
-    const float q     = 1500.0f * powf(2.f, kOneTwelfth * decay_ * 80.0f);
-    const float tone_f
-        = fmin(4.0f * f0_ * powf(2.f, kOneTwelfth * tone_ * 108.0f), 1.0f);
-    const float exciter_leak = 0.08f * (tone_ + 0.25f);
+    if(dirty_)
+    {
+        Update();
+    }
+    const float scale        = scale_;
+    const float q            = q_;
+    const float tone_f       = tone_f_;
+    const float exciter_leak = exciter_leak_;
 
 
     if(trigger || trig_)
@@ -149,6 +162,14 @@ float AnalogBassDrum::Process(bool trigger)
     return tone_lp_;
 }
 
+void AnalogBassDrum::Render(bool trigger, float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process(trigger && i == 0);
+    }
+}
+
 void AnalogBassDrum::Trig()
 {
     trig_ = true;
@@ -168,17 +189,22 @@ void AnalogBassDrum::SetFreq(float f0)
 {
     f0 /= sample_rate_;
     f0_ = fclamp(f0, 0.f, .5f);
+
+    dirty_ = true;
 }
 
 void AnalogBassDrum::SetTone(float tone)
 {
-    tone_ = fclamp(tone, 0.f, 1.f);
+    tone_  = fclamp(tone, 0.f, 1.f);
+    dirty_ = true;
 }
 
 void AnalogBassDrum::SetDecay(float decay)
 {
     decay_ = decay * .1f;
     decay_ -= .1f;
+
+    dirty_ = true;
 }
 
 void AnalogBassDrum::SetAttackFmAmount(float attack_fm_amount)
@@ -36,6 +36,14 @@ class AnalogBassDrum
     */
     float Process(bool trigger = false);
 
+    /** Renders a block, same as calling Process() size times with the
+        trigger on the first sample only
+        \param trigger - strike the drum at the start of the block
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(bool trigger, float *out, size_t size);
+
     /** Strikes the drum. */
     void Trig();
 
@@ -77,12 +85,18 @@ class AnalogBassDrum
   private:
     inline float Diode(float x);
 
+    // Recomputes the coefficients below, once after a parameter changed
+    void Update();
+
     float sample_rate_;
 
     float accent_, f0_, tone_, decay_;
     float attack_fm_amount_, self_fm_amount_;
 
-    bool trig_, sustain_;
+    // Derived from the parameters, valid while dirty_ is false
+    float scale_, q_, tone_f_, exciter_leak_;
+
+    bool trig_, sustain_, dirty_;
 
     int   pulse_remaining_samples_;
     int   fm_pulse_remaining_samples_;
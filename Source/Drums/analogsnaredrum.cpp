@@ -10,6 +10,7 @@ static const int kNumModes = 5;
 void AnalogSnareDrum::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
+    rng_.Reset();
 
     trig_ = false;
 
@@ -55,17 +56,22 @@ void AnalogSnareDrum::SetFreq(float f0)
 {
     f0  = f0 / sample_rate_;
     f0_ = fclamp(f0, 0.f, .4f);
+
+    dirty_ = true;
 }
 
 void AnalogSnareDrum::SetTone(float tone)
 {
     tone_ = fclamp(tone, 0.f, 1.f);
     tone_ *= 2.f;
+
+    dirty_ = true;
 }
 
 void AnalogSnareDrum::SetDecay(float decay)
 {
     decay_ = decay;
+    dirty_ = true;
     return;
     decay_ = fmax(decay, 0.f);
 }
@@ -73,46 +79,38 @@ void AnalogSnareDrum::SetDecay(float decay)
 void AnalogSnareDrum::SetSnappy(float snappy)
 {
     snappy_ = fclamp(snappy, 0.f, 1.f);
+    dirty_  = true;
 }
 
-float AnalogSnareDrum::Process(bool trigger)
+void AnalogSnareDrum::Update()
 {
     const float decay_xt = decay_ * (1.0f + decay_ * (decay_ - 1.0f));
-    const int   kTriggerPulseDuration = 1.0e-3 * sample_rate_;
-    const float kPulseDecayTime       = 0.1e-3 * sample_rate_;
     const float q = 2000.0f * powf(2.f, kOneTwelfth * decay_xt * 84.0f);
-    const float noise_envelope_decay
+    noise_envelope_decay_
         = 1.0f
           - 0.0017f
                 * powf(2.f,
                        kOneTwelfth * (-decay_ * (50.0f + snappy_ * 10.0f)));
-    const float exciter_leak = snappy_ * (2.0f - snappy_) * 0.1f;
+    exciter_leak_ = snappy_ * (2.0f - snappy_) * 0.1f;
 
-    float snappy = snappy_ * 1.1f - 0.05f;
-    snappy       = fclamp(snappy, 0.0f, 1.0f);
+    snappy_level_ = snappy_ * 1.1f - 0.05f;
+    snappy_level_ = fclamp(snappy_level_, 0.0f, 1.0f);
 
     float tone = tone_;
 
-    if(trigger || trig_)
-    {
-        trig_                    = false;
-        pulse_remaining_samples_ = kTriggerPulseDuration;
-        pulse_height_            = 3.0f + 7.0f * accent_;
-        noise_envelope_          = 2.0f;
-    }
-
     static const float kModeFrequencies[kNumModes]
         = {1.00f, 2.00f, 3.18f, 4.16f, 5.62f};
 
-    float f[kNumModes];
-    float gain[kNumModes];
+    float* f    = mode_f_;
+    float* gain = mode_gain_;
 
     for(int i = 0; i < kNumModes; ++i)
     {
         f[i] = fmin(f0_ * kModeFrequencies[i], 0.499f);
+        //        mode_res_[i] = 1.0f + f[i] * (i == 0 ? q : q * 0.25f);
+        mode_res_[i] = (f[i] * (i == 0 ? q : q * 0.25f)) * .2;
         resonator_[i].SetFreq(f[i] * sample_rate_);
-        //        resonator_[i].SetRes(1.0f + f[i] * (i == 0 ? q : q * 0.25f));
-        resonator_[i].SetRes((f[i] * (i == 0 ? q : q * 0.25f)) * .2);
+        resonator_[i].SetRes(mode_res_[i]);
     }
 
     if(tone < 0.666667f)
@@ -141,9 +139,27 @@ float AnalogSnareDrum::Process(bool trigger)
 
     float f_noise = f0_ * 16.0f;
     fclamp(f_noise, 0.0f, 0.499f);
-    noise_filter_.SetFreq(f_noise * sample_rate_);
-    //noise_filter_.SetRes(1.0f + f_noise * 1.5f);
-    noise_filter_.SetRes(f_noise * 1.5f);
+    noise_freq_ = f_noise * sample_rate_;
+    //noise_res_ = 1.0f + f_noise * 1.5f;
+    noise_res_ = f_noise * 1.5f;
+    noise_filter_.SetFreq(noise_freq_);
+    noise_filter_.SetRes(noise_res_);
+
+    dirty_ = false;
+}
+
+float AnalogSnareDrum::Excite(bool trigger, float &noise, float &sustained)
+{
+    const int   kTriggerPulseDuration = 1.0e-3 * sample_rate_;
+    const float kPulseDecayTime       = 0.1e-3 * sample_rate_;
+
+    if(trigger || trig_)
+    {
+        trig_                    = false;
+        pulse_remaining_samples_ = kTriggerPulseDuration;
+        pulse_height_            = 3.0f + 7.0f * accent_;
+        noise_envelope_          = 2.0f;
+    }
 
     // Q45 / Q46
     float pulse = 0.0f;
@@ -164,30 +180,57 @@ float AnalogSnareDrum::Process(bool trigger)
     // R189 / C57 / R190 + C58 / C59 / R197 / R196 / IC14
     pulse_lp_ = fclamp(pulse_lp_, pulse, 0.75f);
 
+    for(int i = 0; i < kNumModes; ++i)
+    {
+        phase_[i] += mode_f_[i];
+        phase_[i] = phase_[i] >= 1.f ? phase_[i] - 1.f : phase_[i];
+    }
+    sustained = 0.0f;
+    if(sustain_)
+    {
+        for(int i = 0; i < kNumModes; ++i)
+        {
+            sustained
+                += mode_gain_[i]
+                   * (sin(phase_[i] * TWOPI_F) * sustain_gain_value * 0.25f);
+        }
+    }
+
+    // C56 / R194 / Q48 / C54 / R188 / D54
+    noise = rng_.NextBipolar();
+    if(noise < 0.0f)
+        noise = 0.0f;
+    noise_envelope_ *= noise_envelope_decay_;
+    noise *= (sustain_ ? sustain_gain_value : noise_envelope_) * snappy_level_
+             * 2.0f;
+
+    return pulse;
+}
+
+float AnalogSnareDrum::Process(bool trigger)
+{
+    if(dirty_)
+    {
+        Update();
+    }
+    const float* gain         = mode_gain_;
+    const float  exciter_leak = exciter_leak_;
+    const float  snappy       = snappy_level_;
+
+    float       noise, sustained;
+    const float pulse = Excite(trigger, noise, sustained);
+
     float shell = 0.0f;
     for(int i = 0; i < kNumModes; ++i)
     {
         float excitation
             = i == 0 ? (pulse - pulse_lp_) + 0.006f * pulse : 0.026f * pulse;
 
-        phase_[i] += f[i];
-        phase_[i] = phase_[i] >= 1.f ? phase_[i] - 1.f : phase_[i];
-
         resonator_[i].Process(excitation);
 
-        shell += gain[i]
-                 * (sustain_
-                        ? sin(phase_[i] * TWOPI_F) * sustain_gain_value * 0.25f
-                        : resonator_[i].Band() + excitation * exciter_leak);
+        shell += gain[i] * (resonator_[i].Band() + excitation * exciter_leak);
     }
-    shell = SoftClip(shell);
-
-    // C56 / R194 / Q48 / C54 / R188 / D54
-    float noise = 2.0f * rand() * kRandFrac - 1.0f;
-    if(noise < 0.0f)
-        noise = 0.0f;
-    noise_envelope_ *= noise_envelope_decay;
-    noise *= (sustain_ ? sustain_gain_value : noise_envelope_) * snappy * 2.0f;
+    shell = SoftClip(sustain_ ? sustained : shell);
 
     // C66 / R201 / C67 / R202 / R203 / Q49
     noise_filter_.Process(noise);
@@ -197,6 +240,14 @@ float AnalogSnareDrum::Process(bool trigger)
     return noise + shell * (1.0f - snappy);
 }
 
+void AnalogSnareDrum::Render(bool trigger, float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process(trigger && i == 0);
+    }
+}
+
 inline float AnalogSnareDrum::SoftLimit(float x)
 {
     return x * (27.0f + x * x) / (27.0f + 9.0f * x * x);
@@ -3,6 +3,7 @@
 #define DSY_ANALOG_SNARE_H
 
 #include "Filters/svf.h"
+#include "Utility/random.h"
 
 #include <stdint.h>
 #ifdef __cplusplus
@@ -37,6 +38,14 @@ class AnalogSnareDrum
     */
     float Process(bool trigger = false);
 
+    /** Renders a block, same as calling Process() size times with the
+        trigger on the first sample only
+        \param trigger - strike the drum at the start of the block
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(bool trigger, float *out, size_t size);
+
     /** Trigger the drum */
     void Trig();
 
@@ -70,16 +79,39 @@ class AnalogSnareDrum
     */
     void SetSnappy(float snappy);
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
     float sample_rate_;
 
     float f0_, tone_, accent_, snappy_, decay_;
     bool  sustain_;
     bool  trig_;
+    bool  dirty_;
 
     inline float SoftLimit(float x);
     inline float SoftClip(float x);
 
+    // Recomputes the coefficients below and tunes the filters, once after
+    // a parameter changed
+    void Update();
+
+    // Runs one sample of everything but the filters: the trigger, the
+    // pulse, the noise envelope and the sine oscillators of sustain mode.
+    // Returns the pulse, the noise filter input in noise and, in sustain
+    // mode, the shell in sustained.
+    float Excite(bool trigger, float &noise, float &sustained);
+
+    // Derived from the parameters, valid while dirty_ is false
+    float mode_f_[kNumModes], mode_res_[kNumModes], mode_gain_[kNumModes];
+    float noise_freq_, noise_res_;
+    float noise_envelope_decay_, exciter_leak_, snappy_level_;
+
+    // Renders many voices with the filters of all of them side by side
+    template <typename Voice, size_t num_voices>
+    friend class DrumBank;
+
     int   pulse_remaining_samples_;
     float pulse_;
     float pulse_height_;
@@ -87,8 +119,9 @@ class AnalogSnareDrum
     float noise_envelope_;
     float sustain_gain_;
 
-    Svf resonator_[kNumModes];
-    Svf noise_filter_;
+    Svf    resonator_[kNumModes];
+    Svf    noise_filter_;
+    Random rng_;
 
     // Replace the resonators in "free running" (sustain) mode.
     float phase_[kNumModes];
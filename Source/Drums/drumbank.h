@@ -0,0 +1,426 @@
+#pragma once
+#ifndef DSY_DRUMBANK_H
+#define DSY_DRUMBANK_H
+
+#include <stddef.h>
+#include <string.h>
+#include "Drums/analogsnaredrum.h"
+#include "Drums/hihat.h"
+#include "Utility/dsp.h"
+#include "Filters/svfbank.h"
+#include "Utility/simd.h"
+#ifdef __cplusplus
+
+/** @file drumbank.h */
+
+namespace daisysp
+{
+/** Voices, triggers and block rendering shared by every DrumBank.
+    Derived renders one chunk of interleaved frames in RenderFrames().
+*/
+template <typename Derived, typename Voice, size_t num_voices>
+class DrumBankBase
+{
+  public:
+    /** Marks a voice that has no trigger pending */
+    static constexpr size_t kNoTrigger = static_cast<size_t>(-1);
+
+    /** Returns a voice, to set its parameters. Render the voice through the
+        bank only, not with its own Process() or Render().
+        \param voice - voice index, 0 to num_voices - 1
+    */
+    Voice &GetVoice(size_t voice) { return voices_[voice]; }
+
+    /** Strikes a voice at a given sample of the next block. Offsets past the
+        end of that block are kept for the blocks after it. A voice holds
+        one pending trigger, a new one replaces it.
+        \param voice - voice index, 0 to num_voices - 1
+        \param offset - samples from the start of the next Render() call
+    */
+    void Trig(size_t voice, size_t offset = 0) { trigger_[voice] = offset; }
+
+    /** Renders all voices as interleaved frames: sample s of voice v is
+        written to out[s * num_voices + v].
+        \param out - size * num_voices output samples
+        \param size - number of frames
+    */
+    void Render(float *out, size_t size)
+    {
+        while(size > 0)
+        {
+            const size_t todo = size < kBlockChunk ? size : kBlockChunk;
+            static_cast<Derived *>(this)->RenderFrames(out, todo);
+            AdvanceTriggers(todo);
+            out += todo * num_voices;
+            size -= todo;
+        }
+    }
+
+    /** Renders all voices and writes their sum, taken in voice order
+        \param out - output buffer
+        \param size - number of samples
+    */
+    void RenderSum(float *out, size_t size)
+    {
+        while(size > 0)
+        {
+            const size_t todo = size < kBlockChunk ? size : kBlockChunk;
+            static_cast<Derived *>(this)->RenderFrames(frames_, todo);
+            AdvanceTriggers(todo);
+            for(size_t i = 0; i < todo; i++)
+            {
+                const float *frame = frames_ + i * num_voices;
+                float        sum   = frame[0];
+                for(size_t v = 1; v < num_voices; v++)
+                {
+                    sum += frame[v];
+                }
+                out[i] = sum;
+            }
+            out += todo;
+            size -= todo;
+        }
+    }
+
+  protected:
+    static constexpr size_t kBlockChunk = 32;
+
+    void InitVoices(float sample_rate)
+    {
+        for(size_t v = 0; v < num_voices; v++)
+        {
+            voices_[v].Init(sample_rate);
+            trigger_[v] = kNoTrigger;
+        }
+    }
+
+    /** Frame of the current chunk the voice is struck at, or kNoTrigger */
+    size_t GetTrigger(size_t voice, size_t size) const
+    {
+        return trigger_[voice] < size ? trigger_[voice] : kNoTrigger;
+    }
+
+    Voice voices_[num_voices];
+
+  private:
+    void AdvanceTriggers(size_t size)
+    {
+        for(size_t v = 0; v < num_voices; v++)
+        {
+            if(trigger_[v] != kNoTrigger)
+            {
+                trigger_[v] = trigger_[v] < size ? kNoTrigger
+                                                 : trigger_[v] - size;
+            }
+        }
+    }
+
+    size_t trigger_[num_voices];
+    float  frames_[kBlockChunk * num_voices];
+};
+
+/** Bank of num_voices drum voices of one type, rendered together.
+
+    The voices are triggered with sample offsets inside the block, and the
+    bank writes either every voice, as interleaved frames like SvfBank, or
+    their sum. Parameters are set on the voices themselves:
+
+    \code
+    DrumBank<AnalogSnareDrum, 16> snares;
+    snares.Init(sample_rate);
+    snares.GetVoice(3).SetFreq(180.f);
+    snares.Trig(3, 17); // 17 samples into the next block
+    snares.RenderSum(out, size);
+    \endcode
+
+    This generic version renders any voice with a
+    Render(bool trigger, float *out, size_t size) method, one voice after
+    the other. AnalogSnareDrum and HiHat have specializations that keep
+    their filters structure-of-arrays style and run them for all voices
+    in one pass with SIMD. Both give the same output as rendering the
+    voices one by one.
+
+    AnalogBassDrum has no specialization and is not structure-of-arrays.
+    Its resonator is retuned every sample from its own low pass output, and
+    the tuning goes through LutSin(), a table lookup. Vector lanes would
+    need one lookup per voice anyway, or simd::Sin2Pi(), which rounds
+    differently, and the feedback makes that difference grow. So the bank
+    renders it voice by voice, which keeps its output exact.
+
+    \param Voice - drum voice type, e.g. AnalogBassDrum or SyntheticSnareDrum
+    \param num_voices - number of voices
+*/
+template <typename Voice, size_t num_voices>
+class DrumBank
+: public DrumBankBase<DrumBank<Voice, num_voices>, Voice, num_voices>
+{
+  public:
+    DrumBank() {}
+    ~DrumBank() {}
+
+    /** Initializes all voices
+        \param sample_rate - sample rate of the audio engine being run
+    */
+    void Init(float sample_rate) { this->InitVoices(sample_rate); }
+
+  private:
+    typedef DrumBankBase<DrumBank<Voice, num_voices>, Voice, num_voices> Base;
+    friend Base;
+
+    void RenderFrames(float *frames, size_t size)
+    {
+        float buf[Base::kBlockChunk];
+        for(size_t v = 0; v < num_voices; v++)
+        {
+            Voice       &voice = this->voices_[v];
+            const size_t t     = DSY_MIN(this->GetTrigger(v, size), size);
+            if(t > 0)
+                voice.Render(false, buf, t);
+            if(t < size)
+                voice.Render(true, buf + t, size - t);
+            for(size_t i = 0; i < size; i++)
+            {
+                frames[i * num_voices + v] = buf[i];
+            }
+        }
+    }
+};
+
+/** Bank of AnalogSnareDrums with the filters of all voices side by side.
+
+    The pulse and noise envelopes still run per voice, the six filters of
+    every voice (five shell modes and the noise filter) run as SvfBanks,
+    4 or 8 voices per instruction, and the shells are mixed and clipped
+    the same way. The output is the same as rendering the voices one by
+    one.
+
+    \param num_voices - number of voices, a multiple of 4
+*/
+template <size_t num_voices>
+class DrumBank<AnalogSnareDrum, num_voices>
+: public DrumBankBase<DrumBank<AnalogSnareDrum, num_voices>,
+                      AnalogSnareDrum,
+                      num_voices>
+{
+  public:
+    static_assert(num_voices > 0 && num_voices % 4 == 0,
+                  "DrumBank<AnalogSnareDrum>: voices must be a multiple of 4");
+
+    DrumBank() {}
+    ~DrumBank() {}
+
+    /** Initializes all voices
+        \param sample_rate - sample rate of the audio engine being run
+    */
+    void Init(float sample_rate)
+    {
+        this->InitVoices(sample_rate);
+        for(int m = 0; m < kNumModes; m++)
+        {
+            modes_[m].Init(sample_rate);
+        }
+        noise_filter_.Init(sample_rate);
+    }
+
+  private:
+    typedef DrumBankBase<DrumBank<AnalogSnareDrum, num_voices>,
+                         AnalogSnareDrum,
+                         num_voices>
+        Base;
+    friend Base;
+
+    static constexpr int    kNumModes = AnalogSnareDrum::kNumModes;
+    static constexpr size_t kWidth    = simd::LaneWidth<num_voices>::value;
+    static constexpr size_t kFrames   = Base::kBlockChunk * num_voices;
+    typedef simd::FloatVec<kWidth> Vec;
+
+    // Copies the coefficients of voices whose parameters changed
+    void UpdateVoices()
+    {
+        for(size_t v = 0; v < num_voices; v++)
+        {
+            AnalogSnareDrum &voice = this->voices_[v];
+            sustain_[v]            = voice.sustain_ ? 1.0f : 0.0f;
+            if(!voice.dirty_)
+                continue;
+
+            voice.Update();
+            for(int m = 0; m < kNumModes; m++)
+            {
+                modes_[m].SetFreq(v, voice.mode_f_[m] * voice.sample_rate_);
+                modes_[m].SetRes(v, voice.mode_res_[m]);
+                gain_[m][v] = voice.mode_gain_[m];
+            }
+            noise_filter_.SetFreq(v, voice.noise_freq_);
+            noise_filter_.SetRes(v, voice.noise_res_);
+            leak_[v]   = voice.exciter_leak_;
+            snappy_[v] = voice.snappy_level_;
+        }
+    }
+
+    void RenderFrames(float *frames, size_t size)
+    {
+        UpdateVoices();
+
+        for(size_t v = 0; v < num_voices; v++)
+        {
+            AnalogSnareDrum &voice   = this->voices_[v];
+            const size_t     trigger = this->GetTrigger(v, size);
+            for(size_t i = 0, idx = v; i < size; i++, idx += num_voices)
+            {
+                float       noise, sustained;
+                const float pulse = voice.Excite(i == trigger, noise, sustained);
+                body_[idx]      = (pulse - voice.pulse_lp_) + 0.006f * pulse;
+                overtones_[idx] = 0.026f * pulse;
+                noise_[idx]     = noise;
+                sustained_[idx] = sustained;
+            }
+        }
+
+        const size_t total = size * num_voices;
+        memset(shell_, 0, total * sizeof(float));
+        for(int m = 0; m < kNumModes; m++)
+        {
+            const float *excitation = m == 0 ? body_ : overtones_;
+            modes_[m].ProcessBlock(
+                excitation, nullptr, nullptr, band_, nullptr, nullptr, size);
+            for(size_t lane = 0; lane < num_voices; lane += kWidth)
+            {
+                const Vec gain = Vec::Load(gain_[m] + lane);
+                const Vec leak = Vec::Load(leak_ + lane);
+                for(size_t idx = lane; idx < total; idx += num_voices)
+                {
+                    const Vec shell = Vec::Load(shell_ + idx);
+                    const Vec band  = Vec::Load(band_ + idx);
+                    const Vec x     = Vec::Load(excitation + idx);
+                    (shell + gain * (band + x * leak)).Store(shell_ + idx);
+                }
+            }
+        }
+
+        noise_filter_.ProcessBlock(
+            noise_, nullptr, nullptr, band_, nullptr, nullptr, size);
+
+        const Vec one(1.0f);
+        for(size_t lane = 0; lane < num_voices; lane += kWidth)
+        {
+            const Vec sustain = Vec::Load(sustain_ + lane);
+            const Vec dry     = one - Vec::Load(snappy_ + lane);
+            for(size_t idx = lane; idx < total; idx += num_voices)
+            {
+                Vec shell = Vec::Load(shell_ + idx) * (one - sustain)
+                            + Vec::Load(sustained_ + idx) * sustain;
+                shell = SoftClip(shell);
+                (Vec::Load(band_ + idx) + shell * dry).Store(frames + idx);
+            }
+        }
+    }
+
+    // Same as AnalogSnareDrum::SoftClip(), which reaches exactly +-1 at +-3
+    static inline Vec SoftClip(Vec x)
+    {
+        x = Min(Max(x, Vec(-3.0f)), Vec(3.0f));
+        return x * (Vec(27.0f) + x * x) / (Vec(27.0f) + Vec(9.0f) * x * x);
+    }
+
+    SvfBank<num_voices> modes_[kNumModes];
+    SvfBank<num_voices> noise_filter_;
+
+    float gain_[kNumModes][num_voices];
+    float leak_[num_voices], snappy_[num_voices], sustain_[num_voices];
+
+    float body_[kFrames], overtones_[kFrames], noise_[kFrames];
+    float sustained_[kFrames], shell_[kFrames], band_[kFrames];
+};
+
+/** Bank of HiHats with the filters of all voices side by side.
+
+    The metallic noise, the clocked noise and the VCA still run per voice,
+    with the voices' block Render() code. The band pass on the metallic
+    noise and the output high pass run as SvfBanks, 4 or 8 voices per
+    instruction. The output is the same as rendering the voices one by
+    one.
+
+    \param num_voices - number of voices, a multiple of 4
+*/
+template <typename MetallicNoiseSource,
+          typename VCA,
+          bool resonance,
+          size_t num_voices>
+class DrumBank<HiHat<MetallicNoiseSource, VCA, resonance>, num_voices>
+: public DrumBankBase<
+      DrumBank<HiHat<MetallicNoiseSource, VCA, resonance>, num_voices>,
+      HiHat<MetallicNoiseSource, VCA, resonance>,
+      num_voices>
+{
+  public:
+    static_assert(num_voices > 0 && num_voices % 4 == 0,
+                  "DrumBank<HiHat>: voices must be a multiple of 4");
+
+    DrumBank() {}
+    ~DrumBank() {}
+
+    /** Initializes all voices
+        \param sample_rate - sample rate of the audio engine being run
+    */
+    void Init(float sample_rate)
+    {
+        this->InitVoices(sample_rate);
+        coloration_.Init(sample_rate);
+        hpf_.Init(sample_rate);
+        hpf_.SetRes(.5f);
+    }
+
+  private:
+    typedef HiHat<MetallicNoiseSource, VCA, resonance> Voice;
+    typedef DrumBankBase<DrumBank<Voice, num_voices>, Voice, num_voices> Base;
+    friend Base;
+
+    static constexpr size_t kFrames = Base::kBlockChunk * num_voices;
+
+    void RenderFrames(float *frames, size_t size)
+    {
+        float buf[Base::kBlockChunk];
+
+        for(size_t v = 0; v < num_voices; v++)
+        {
+            Voice &voice = this->voices_[v];
+            voice.UpdateBlock();
+            coloration_.SetFreq(v, voice.cutoff_);
+            coloration_.SetRes(v, resonance ? 3.0f + 6.0f * voice.tone_ : 1.0f);
+            hpf_.SetFreq(v, voice.cutoff_);
+
+            voice.metallic_noise_.Render(2.0f * voice.f0_, buf, size);
+            for(size_t i = 0; i < size; i++)
+            {
+                noise_[i * num_voices + v] = buf[i];
+            }
+        }
+
+        coloration_.ProcessBlock(
+            noise_, nullptr, nullptr, band_, nullptr, nullptr, size);
+
+        for(size_t v = 0; v < num_voices; v++)
+        {
+            for(size_t i = 0; i < size; i++)
+            {
+                buf[i] = band_[i * num_voices + v];
+            }
+            this->voices_[v].Shape(buf, size, this->GetTrigger(v, size));
+            for(size_t i = 0; i < size; i++)
+            {
+                band_[i * num_voices + v] = buf[i];
+            }
+        }
+
+        hpf_.ProcessBlock(band_, nullptr, frames, nullptr, nullptr, nullptr, size);
+    }
+
+    SvfBank<num_voices> coloration_;
+    SvfBank<num_voices> hpf_;
+
+    float noise_[kFrames], band_[kFrames];
+};
+} // namespace daisysp
+#endif
+#endif
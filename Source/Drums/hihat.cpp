@@ -12,7 +12,7 @@ void SquareNoise::Init(float sample_rate)
     }
 }
 
-float SquareNoise::Process(float f0)
+void SquareNoise::SetIncrements(float f0, uint32_t* increment) const
 {
     const float ratios[6] = {// Nominal f0: 414 Hz
                              1.0f,
@@ -22,15 +22,23 @@ float SquareNoise::Process(float f0)
                              1.932f,
                              2.536f};
 
-    uint32_t increment[6];
-    uint32_t phase[6];
     for(int i = 0; i < 6; ++i)
     {
         float f = f0 * ratios[i];
         if(f >= 0.499f)
             f = 0.499f;
         increment[i] = static_cast<uint32_t>(f * 4294967296.0f);
-        phase[i]     = phase_[i];
+    }
+}
+
+float SquareNoise::Process(float f0)
+{
+    uint32_t increment[6];
+    uint32_t phase[6];
+    SetIncrements(f0, increment);
+    for(int i = 0; i < 6; ++i)
+    {
+        phase[i] = phase_[i];
     }
 
     phase[0] += increment[0];
@@ -55,6 +63,42 @@ float SquareNoise::Process(float f0)
     return 0.33f * static_cast<float>(noise) - 1.0f;
 }
 
+void SquareNoise::Render(float f0, float* out, size_t size)
+{
+    uint32_t increment[6];
+    SetIncrements(f0, increment);
+
+    // One oscillator at a time over the whole chunk: the phase is a plain
+    // induction variable and the square is its top bit, so the inner loop
+    // has no branch and vectorizes over samples.
+    int32_t noise[kBlockChunk];
+    while(size > 0)
+    {
+        const size_t todo = size < kBlockChunk ? size : kBlockChunk;
+        for(size_t i = 0; i < todo; i++)
+        {
+            noise[i] = 0;
+        }
+        for(int osc = 0; osc < 6; ++osc)
+        {
+            const uint32_t inc   = increment[osc];
+            uint32_t       phase = phase_[osc];
+            for(size_t i = 0; i < todo; i++)
+            {
+                phase += inc;
+                noise[i] += static_cast<int32_t>(phase >> 31);
+            }
+            phase_[osc] = phase;
+        }
+        for(size_t i = 0; i < todo; i++)
+        {
+            out[i] = 0.33f * static_cast<float>(noise[i]) - 1.0f;
+        }
+        out += todo;
+        size -= todo;
+    }
+}
+
 void RingModNoise::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
@@ -65,7 +109,7 @@ void RingModNoise::Init(float sample_rate)
     }
 }
 
-float RingModNoise::Process(float f0)
+void RingModNoise::SetFreq(float f0)
 {
     const float ratio = f0 / (0.01f + f0);
     const float f1a   = 200.0f / sample_rate_ * ratio;
@@ -75,22 +119,58 @@ float RingModNoise::Process(float f0)
     const float f3a   = 730.0f / sample_rate_ * ratio;
     const float f3b   = 10500.0f / sample_rate_ * ratio;
 
-    float out = ProcessPair(&oscillator_[0], f1a, f1b);
-    out += ProcessPair(&oscillator_[2], f2a, f2b);
-    out += ProcessPair(&oscillator_[4], f3a, f3b);
+    const float f[6] = {f1a, f1b, f2a, f2b, f3a, f3b};
+    for(int i = 0; i < 6; i += 2)
+    {
+        oscillator_[i].SetWaveform(Oscillator::WAVE_SQUARE);
+        oscillator_[i].SetFreq(f[i] * sample_rate_);
+        oscillator_[i + 1].SetWaveform(Oscillator::WAVE_SAW);
+        oscillator_[i + 1].SetFreq(f[i + 1] * sample_rate_);
+    }
+}
+
+float RingModNoise::Process(float f0)
+{
+    SetFreq(f0);
+
+    float out = oscillator_[0].Process() * oscillator_[1].Process();
+    out += oscillator_[2].Process() * oscillator_[3].Process();
+    out += oscillator_[4].Process() * oscillator_[5].Process();
 
     return out;
 }
 
-float RingModNoise::ProcessPair(Oscillator* osc, float f1, float f2)
+void RingModNoise::Render(float f0, float* out, size_t size)
 {
-    osc[0].SetWaveform(Oscillator::WAVE_SQUARE);
-    osc[0].SetFreq(f1 * sample_rate_);
-    float temp_1 = osc[0].Process();
-
-    osc[1].SetWaveform(Oscillator::WAVE_SAW);
-    osc[1].SetFreq(f2 * sample_rate_);
-    float temp_2 = osc[1].Process();
+    // The frequencies hold for the whole block, so each oscillator renders
+    // a chunk with its waveform picked once, and the pairs are multiplied
+    // and summed chunk by chunk.
+    SetFreq(f0);
 
-    return temp_1 * temp_2;
-}
\ No newline at end of file
+    float square[kBlockChunk], saw[kBlockChunk];
+    while(size > 0)
+    {
+        const size_t todo = size < kBlockChunk ? size : kBlockChunk;
+        for(int pair = 0; pair < 3; ++pair)
+        {
+            oscillator_[2 * pair].Render(square, todo);
+            oscillator_[2 * pair + 1].Render(saw, todo);
+            if(pair == 0)
+            {
+                for(size_t i = 0; i < todo; i++)
+                {
+                    out[i] = square[i] * saw[i];
+                }
+            }
+            else
+            {
+                for(size_t i = 0; i < todo; i++)
+                {
+                    out[i] += square[i] * saw[i];
+                }
+            }
+        }
+        out += todo;
+        size -= todo;
+    }
+}
@@ -4,6 +4,7 @@
 
 #include "Filters/svf.h"
 #include "Synthesis/oscillator.h"
+#include "Utility/random.h"
 
 #include <stdint.h>
 #include <stdlib.h>
@@ -31,7 +32,18 @@ class SquareNoise
 
     float Process(float f0);
 
+    /** Renders a block, same as calling Process(f0) size times
+        \param f0 - root frequency, normalized
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float f0, float* out, size_t size);
+
   private:
+    static constexpr size_t kBlockChunk = 48;
+
+    void SetIncrements(float f0, uint32_t* increment) const;
+
     uint32_t phase_[6];
 };
 
@@ -53,8 +65,18 @@ class RingModNoise
 
     float Process(float f0);
 
+    /** Renders a block, same as calling Process(f0) size times
+        \param f0 - root frequency, normalized
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float f0, float* out, size_t size);
+
   private:
-    float      ProcessPair(Oscillator* osc, float f1, float f2);
+    static constexpr size_t kBlockChunk = 48;
+
+    // Tunes the three square / saw pairs that are multiplied together
+    void       SetFreq(float f0);
     Oscillator oscillator_[6];
 
     float sample_rate_;
@@ -118,6 +140,7 @@ class HiHat
     void Init(float sample_rate)
     {
         sample_rate_ = sample_rate;
+        rng_.Reset();
 
         trig_ = false;
 
@@ -181,7 +204,7 @@ class HiHat
         if(noise_clock_ >= 1.0f)
         {
             noise_clock_ -= 1.0f;
-            noise_sample_ = rand() * kRandFrac - 0.5f;
+            noise_sample_ = rng_.NextFloat() - 0.5f;
         }
         out += noisiness_ * (noise_sample_ - out);
 
@@ -199,6 +222,39 @@ class HiHat
         return out;
     }
 
+    /** Renders a block, same as calling Process() size times with the
+        trigger on the first sample only. The metallic noise is rendered a
+        block at a time too, so MetallicNoiseSource needs a
+        Render(float f0, float *out, size_t size) method for this, like
+        SquareNoise and RingModNoise have.
+        \param trigger - hit the hihat at the start of the block
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(bool trigger, float *out, size_t size)
+    {
+        UpdateBlock();
+        noise_coloration_svf_.SetFreq(cutoff_);
+        noise_coloration_svf_.SetRes(resonance ? 3.0f + 6.0f * tone_ : 1.0f);
+        hpf_.SetFreq(cutoff_);
+        hpf_.SetRes(.5f);
+
+        while(size > 0)
+        {
+            const size_t todo = size < kBlockChunk ? size : kBlockChunk;
+
+            metallic_noise_.Render(2.0f * f0_, out, todo);
+            noise_coloration_svf_.ProcessBlock(
+                out, nullptr, nullptr, out, nullptr, nullptr, todo);
+            Shape(out, todo, trigger ? 0 : todo);
+            hpf_.ProcessBlock(out, nullptr, out, nullptr, nullptr, nullptr, todo);
+
+            trigger = false;
+            out += todo;
+            size -= todo;
+        }
+    }
+
     /** Trigger the hihat */
     void Trig() { trig_ = true; }
 
@@ -245,8 +301,12 @@ class HiHat
         noisiness_ *= noisiness_;
     }
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
 
   private:
+    static constexpr size_t kBlockChunk = 48;
+
     float sample_rate_;
 
     float accent_, f0_, tone_, decay_, noisiness_;
@@ -255,6 +315,60 @@ class HiHat
 
     float SemitonesToRatio(float in) { return powf(2.f, in * kOneTwelfth); }
 
+    // The parameters hold for a whole block, so Render() and DrumBank
+    // compute what Process() computes from them each sample once here.
+    void UpdateBlock()
+    {
+        envelope_decay_ = 1.0f - 0.003f * SemitonesToRatio(-decay_ * 84.0f);
+        cut_decay_      = 1.0f - 0.0025f * SemitonesToRatio(-decay_ * 36.0f);
+
+        float cutoff = 150.0f / sample_rate_ * SemitonesToRatio(tone_ * 72.0f);
+        cutoff       = fclamp(cutoff, 0.0f, 16000.0f / sample_rate_);
+        cutoff_      = cutoff * sample_rate_;
+
+        noise_f_ = f0_ * (16.0f + 16.0f * (1.0f - noisiness_));
+        noise_f_ = fclamp(noise_f_, 0.0f, 0.5f);
+
+        sustain_gain_ = accent_ * decay_;
+    }
+
+    // The part of Process() between the two filters: adds the clocked noise
+    // to the band passed metallic noise in out and applies the VCA.
+    // Strikes the hihat at sample strike, if that is inside the block.
+    void Shape(float *out, size_t size, size_t strike)
+    {
+        VCA vca;
+        for(size_t i = 0; i < size; i++)
+        {
+            if(i == strike || trig_)
+            {
+                trig_ = false;
+
+                envelope_
+                    = (1.5f + 0.5f * (1.0f - decay_)) * (0.3f + 0.7f * accent_);
+            }
+
+            noise_clock_ += noise_f_;
+            if(noise_clock_ >= 1.0f)
+            {
+                noise_clock_ -= 1.0f;
+                noise_sample_ = rng_.NextFloat() - 0.5f;
+            }
+            float s = out[i];
+            s += noisiness_ * (noise_sample_ - s);
+
+            envelope_ *= envelope_ > 0.5f ? envelope_decay_ : cut_decay_;
+            out[i] = vca(s, sustain_ ? sustain_gain_ : envelope_);
+        }
+    }
+
+    // Valid after UpdateBlock(), cutoff_ in Hz
+    float envelope_decay_, cut_decay_, cutoff_, noise_f_;
+
+    // Renders many voices with the filters of all of them side by side
+    template <typename Voice, size_t num_voices>
+    friend class DrumBank;
+
     float envelope_;
     float noise_clock_;
     float noise_sample_;
@@ -263,6 +377,7 @@ class HiHat
     MetallicNoiseSource metallic_noise_;
     Svf                 noise_coloration_svf_;
     Svf                 hpf_;
+    Random              rng_;
 };
 } // namespace daisysp
 #endif
@@ -26,13 +26,14 @@ float SyntheticBassDrumClick::Process(float in)
 
 void SyntheticBassDrumAttackNoise::Init()
 {
+    rng_.Reset();
     lp_ = 0.0f;
     hp_ = 0.0f;
 }
 
 float SyntheticBassDrumAttackNoise::Process()
 {
-    float sample = rand() * kRandFrac;
+    float sample = rng_.NextFloat();
     fonepole(lp_, sample, 0.05f);
     fonepole(hp_, lp_, 0.005f);
     return lp_ - hp_;
@@ -41,6 +42,7 @@ float SyntheticBassDrumAttackNoise::Process()
 void SyntheticBassDrum::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
+    rng_.Reset();
 
     trig_ = false;
 
@@ -51,6 +53,8 @@ void SyntheticBassDrum::Init(float sample_rate)
     fm_lp_                = 0.0f;
     body_env_lp_          = 0.0f;
     body_env_             = 0.0f;
+    transient_env_        = 0.0f;
+    transient_env_lp_     = 0.0f;
     body_env_pulse_width_ = 0;
     fm_pulse_width_       = 0;
     tone_lp_              = 0.0f;
@@ -92,23 +96,37 @@ inline float SyntheticBassDrum::TransistorVCA(float s, float gain)
     return 3.0f * s / (2.0f + fabsf(s)) + gain * 0.3f;
 }
 
-float SyntheticBassDrum::Process(bool trigger)
+void SyntheticBassDrum::Update()
 {
-    float dirtiness = dirtiness_;
-    dirtiness *= fmax(1.0f - 8.0f * new_f0_, 0.0f);
+    dirtiness_level_ = dirtiness_;
+    dirtiness_level_ *= fmax(1.0f - 8.0f * new_f0_, 0.0f);
 
-    const float fm_decay
+    fm_decay_
         = 1.0f
           - 1.0f / (0.008f * (1.0f + fm_envelope_decay_ * 4.0f) * sample_rate_);
 
-    const float body_env_decay
-        = 1.0f
-          - 1.0f / (0.02f * sample_rate_)
-                * powf(2.f, (-decay_ * 60.0f) * kOneTwelfth);
-    const float transient_env_decay = 1.0f - 1.0f / (0.005f * sample_rate_);
-    const float tone_f              = fmin(
+    body_env_decay_ = 1.0f
+                      - 1.0f / (0.02f * sample_rate_)
+                            * powf(2.f, (-decay_ * 60.0f) * kOneTwelfth);
+    transient_env_decay_ = 1.0f - 1.0f / (0.005f * sample_rate_);
+    tone_f_              = fmin(
         4.0f * new_f0_ * powf(2.f, (tone_ * 108.0f) * kOneTwelfth), 1.0f);
-    const float transient_level = tone_;
+
+    dirty_ = false;
+}
+
+float SyntheticBassDrum::Process(bool trigger)
+{
+    if(dirty_)
+    {
+        Update();
+    }
+    const float dirtiness           = dirtiness_level_;
+    const float fm_decay            = fm_decay_;
+    const float body_env_decay      = body_env_decay_;
+    const float transient_env_decay = transient_env_decay_;
+    const float tone_f              = tone_f_;
+    const float transient_level     = tone_;
 
     if(trigger || trig_)
     {
@@ -121,7 +139,7 @@ float SyntheticBassDrum::Process(bool trigger)
 
     sustain_gain_ = accent_ * decay_;
 
-    fonepole(phase_noise_, rand() * kRandFrac - 0.5f, 0.002f);
+    fonepole(phase_noise_, rng_.NextFloat() - 0.5f, 0.002f);
 
     float mix = 0.0f;
 
@@ -182,6 +200,14 @@ float SyntheticBassDrum::Process(bool trigger)
     return tone_lp_;
 }
 
+void SyntheticBassDrum::Render(bool trigger, float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process(trigger && i == 0);
+    }
+}
+
 void SyntheticBassDrum::Trig()
 {
     trig_ = true;
@@ -201,22 +227,26 @@ void SyntheticBassDrum::SetFreq(float freq)
 {
     freq /= sample_rate_;
     new_f0_ = fclamp(freq, 0.f, 1.f);
+    dirty_  = true;
 }
 
 void SyntheticBassDrum::SetTone(float tone)
 {
-    tone_ = fclamp(tone, 0.f, 1.f);
+    tone_  = fclamp(tone, 0.f, 1.f);
+    dirty_ = true;
 }
 
 void SyntheticBassDrum::SetDecay(float decay)
 {
     decay  = fclamp(decay, 0.f, 1.f);
     decay_ = decay * decay;
+    dirty_ = true;
 }
 
 void SyntheticBassDrum::SetDirtiness(float dirtiness)
 {
     dirtiness_ = fclamp(dirtiness, 0.f, 1.f);
+    dirty_     = true;
 }
 
 void SyntheticBassDrum::SetFmEnvelopeAmount(float fm_envelope_amount)
@@ -228,4 +258,5 @@ void SyntheticBassDrum::SetFmEnvelopeDecay(float fm_envelope_decay)
 {
     fm_envelope_decay  = fclamp(fm_envelope_decay, 0.f, 1.f);
     fm_envelope_decay_ = fm_envelope_decay * fm_envelope_decay;
+    dirty_             = true;
 }
\ No newline at end of file
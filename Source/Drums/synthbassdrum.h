@@ -4,6 +4,7 @@
 
 #include "Filters/svf.h"
 #include "Utility/dsp.h"
+#include "Utility/random.h"
 
 #include <stdint.h>
 #ifdef __cplusplus
@@ -62,9 +63,13 @@ class SyntheticBassDrumAttackNoise
     /** Get the next sample. */
     float Process();
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
-    float lp_;
-    float hp_;
+    float  lp_;
+    float  hp_;
+    Random rng_;
 };
 
 /**  
@@ -79,7 +84,8 @@ class SyntheticBassDrumAttackNoise
 class SyntheticBassDrum
 {
   public:
-    SyntheticBassDrum() {}
+    // The noise sources start from different seeds, see SetSeed()
+    SyntheticBassDrum() { SetSeed(Random::kDefaultSeed); }
     ~SyntheticBassDrum() {}
 
     /** Init the module
@@ -101,6 +107,14 @@ class SyntheticBassDrum
     */
     float Process(bool trigger = false);
 
+    /** Renders a block, same as calling Process() size times with the
+        trigger on the first sample only
+        \param trigger - strike the drum at the start of the block
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(bool trigger, float *out, size_t size);
+
     /** Trigger the drum */
     void Trig();
 
@@ -144,6 +158,13 @@ class SyntheticBassDrum
     */
     void SetFmEnvelopeDecay(float fm_envelope_decay);
 
+    /** Seeds the noise sources, see Random::SetSeed() */
+    void SetSeed(uint32_t seed)
+    {
+        rng_.SetSeed(seed);
+        noise_.SetSeed(seed + 1);
+    }
+
   private:
     float sample_rate_;
 
@@ -151,6 +172,14 @@ class SyntheticBassDrum
     bool  sustain_;
     float accent_, new_f0_, tone_, decay_;
     float dirtiness_, fm_envelope_amount_, fm_envelope_decay_;
+    bool  dirty_;
+
+    // Recomputes the coefficients below, once after a parameter changed
+    void Update();
+
+    // Derived from the parameters, valid while dirty_ is false
+    float dirtiness_level_, fm_decay_, body_env_decay_, transient_env_decay_;
+    float tone_f_;
 
     float f0_;
     float phase_;
@@ -169,6 +198,7 @@ class SyntheticBassDrum
 
     SyntheticBassDrumClick       click_;
     SyntheticBassDrumAttackNoise noise_;
+    Random                       rng_;
 
     int body_env_pulse_width_;
     int fm_pulse_width_;
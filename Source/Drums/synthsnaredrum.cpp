@@ -8,6 +8,7 @@ using namespace daisysp;
 void SyntheticSnareDrum::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
+    rng_.Reset();
 
     phase_[0]        = 0.0f;
     phase_[1]        = 0.0f;
@@ -25,6 +26,7 @@ void SyntheticSnareDrum::Init(float sample_rate)
     SetSnappy(.7f);
 
     trig_ = false;
+    even_ = true;
 
     drum_lp_.Init(sample_rate_);
     snare_hp_.Init(sample_rate_);
@@ -37,12 +39,10 @@ inline float SyntheticSnareDrum::DistortedSine(float phase)
     return 2.0f * triangle / (1.0f + fabsf(triangle));
 }
 
-bool even = true;
-
-float SyntheticSnareDrum::Process(bool trigger)
+void SyntheticSnareDrum::Update()
 {
     const float decay_xt = decay_ * (1.0f + decay_ * (decay_ - 1.0f));
-    const float drum_decay
+    drum_decay_
         = 1.0f
           - 1.0f / (0.015f * sample_rate_)
                 * powf(2.f,
@@ -50,17 +50,17 @@ float SyntheticSnareDrum::Process(bool trigger)
                            * (-decay_xt * 72.0f - fm_amount_ * 12.0f
                               + snappy_ * 7.0f));
 
-    const float snare_decay
+    snare_decay_
         = 1.0f
           - 1.0f / (0.01f * sample_rate_)
                 * powf(2.f, kOneTwelfth * (-decay_ * 60.0f - snappy_ * 7.0f));
-    const float fm_decay = 1.0f - 1.0f / (0.007f * sample_rate_);
+    fm_decay_ = 1.0f - 1.0f / (0.007f * sample_rate_);
 
     float snappy = snappy_ * 1.1f - 0.05f;
     snappy       = fclamp(snappy, 0.0f, 1.0f);
 
-    const float drum_level  = sqrtf(1.0f - snappy);
-    const float snare_level = sqrtf(snappy);
+    drum_level_  = sqrtf(1.0f - snappy);
+    snare_level_ = sqrtf(snappy);
 
     const float snare_f_min = fmin(10.0f * f0_, 0.5f);
     const float snare_f_max = fmin(35.0f * f0_, 0.5f);
@@ -71,6 +71,26 @@ float SyntheticSnareDrum::Process(bool trigger)
 
     drum_lp_.SetFreq(3.0f * f0_ * sample_rate_);
 
+    reset_noise_amount_ = (0.125f - f0_) * 8.0f;
+    reset_noise_amount_ = fclamp(reset_noise_amount_, 0.0f, 1.0f);
+    reset_noise_amount_ *= reset_noise_amount_;
+    reset_noise_amount_ *= fm_amount_;
+
+    dirty_ = false;
+}
+
+float SyntheticSnareDrum::Process(bool trigger)
+{
+    if(dirty_)
+    {
+        Update();
+    }
+    const float drum_decay  = drum_decay_;
+    const float snare_decay = snare_decay_;
+    const float fm_decay    = fm_decay_;
+    const float drum_level  = drum_level_;
+    const float snare_level = snare_level_;
+
     if(trigger || trig_)
     {
         trig_            = false;
@@ -81,7 +101,7 @@ float SyntheticSnareDrum::Process(bool trigger)
             = static_cast<int>((0.04f + decay_ * 0.03f) * sample_rate_);
     }
 
-    even = !even;
+    even_ = !even_;
     if(sustain_)
     {
         sustain_gain_ = snare_amplitude_ = accent_ * decay_;
@@ -95,7 +115,7 @@ float SyntheticSnareDrum::Process(bool trigger)
         // The envelope for the snare has a "hold" stage which lasts between
         // 40 and 70 ms
         drum_amplitude_
-            *= (drum_amplitude_ > 0.03f || even) ? drum_decay : 1.0f;
+            *= (drum_amplitude_ > 0.03f || even_) ? drum_decay : 1.0f;
         if(hold_counter_)
         {
             --hold_counter_;
@@ -110,11 +130,8 @@ float SyntheticSnareDrum::Process(bool trigger)
     // The 909 circuit has a funny kind of oscillator coupling - the signal
     // leaving Q40's collector and resetting all oscillators allow some
     // intermodulation.
-    float reset_noise        = 0.0f;
-    float reset_noise_amount = (0.125f - f0_) * 8.0f;
-    reset_noise_amount       = fclamp(reset_noise_amount, 0.0f, 1.0f);
-    reset_noise_amount *= reset_noise_amount;
-    reset_noise_amount *= fm_amount_;
+    float       reset_noise        = 0.0f;
+    const float reset_noise_amount = reset_noise_amount_;
     reset_noise += phase_[0] > 0.5f ? -1.0f : 1.0f;
     reset_noise += phase_[1] > 0.5f ? -1.0f : 1.0f;
     reset_noise *= reset_noise_amount * 0.025f;
@@ -153,7 +170,7 @@ float SyntheticSnareDrum::Process(bool trigger)
     drum_lp_.Process(drum);
     drum = drum_lp_.Low();
 
-    float noise = rand() * kRandFrac;
+    float noise = rng_.NextFloat();
     snare_lp_.Process(noise);
     float snare = snare_lp_.Low();
     snare_hp_.Process(snare);
@@ -163,6 +180,14 @@ float SyntheticSnareDrum::Process(bool trigger)
     return snare + drum; // It's a snare, it's a drum, it's a snare drum.
 }
 
+void SyntheticSnareDrum::Render(bool trigger, float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process(trigger && i == 0);
+    }
+}
+
 void SyntheticSnareDrum::Trig()
 {
     trig_ = true;
@@ -182,20 +207,25 @@ void SyntheticSnareDrum::SetFreq(float f0)
 {
     f0 /= sample_rate_;
     f0_ = fclamp(f0, 0.f, 1.f);
+
+    dirty_ = true;
 }
 
 void SyntheticSnareDrum::SetFmAmount(float fm_amount)
 {
     fm_amount  = fclamp(fm_amount, 0.f, 1.f);
     fm_amount_ = fm_amount * fm_amount;
+    dirty_     = true;
 }
 
 void SyntheticSnareDrum::SetDecay(float decay)
 {
     decay_ = fmax(decay, 0.f);
+    dirty_ = true;
 }
 
 void SyntheticSnareDrum::SetSnappy(float snappy)
 {
     snappy_ = fclamp(snappy, 0.f, 1.f);
+    dirty_  = true;
 }
@@ -3,6 +3,7 @@
 #define DSY_SYNTHSD_H
 
 #include "Filters/svf.h"
+#include "Utility/random.h"
 
 #include <stdint.h>
 #ifdef __cplusplus
@@ -39,6 +40,14 @@ class SyntheticSnareDrum
     */
     float Process(bool trigger = false);
 
+    /** Renders a block, same as calling Process() size times with the
+        trigger on the first sample only
+        \param trigger - strike the drum at the start of the block
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(bool trigger, float *out, size_t size);
+
     /** Trigger the drum */
     void Trig();
 
@@ -72,6 +81,9 @@ class SyntheticSnareDrum
     */
     void SetSnappy(float snappy);
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
     inline float DistortedSine(float phase);
 
@@ -80,6 +92,18 @@ class SyntheticSnareDrum
     bool  trig_;
     bool  sustain_;
     float accent_, f0_, fm_amount_, decay_, snappy_;
+    bool  dirty_;
+
+    // Recomputes the coefficients below and tunes the filters, once after
+    // a parameter changed
+    void Update();
+
+    // Derived from the parameters, valid while dirty_ is false
+    float drum_decay_, snare_decay_, fm_decay_;
+    float drum_level_, snare_level_, reset_noise_amount_;
+
+    // The drum envelope decays on every other sample near the end
+    bool even_;
 
     float phase_[2];
     float drum_amplitude_;
@@ -88,9 +112,10 @@ class SyntheticSnareDrum
     float sustain_gain_;
     int   hold_counter_;
 
-    Svf drum_lp_;
-    Svf snare_hp_;
-    Svf snare_lp_;
+    Svf    drum_lp_;
+    Svf    snare_hp_;
+    Svf    snare_lp_;
+    Random rng_;
 };
 } // namespace daisysp
 #endif
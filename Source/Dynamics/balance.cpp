@@ -54,3 +54,33 @@ float Balance::Process(float sig, float comp)
 
     return out;
 }
+
+void Balance::ProcessBlock(const float *sig,
+                           const float *comp,
+                           float *      out,
+                           size_t       size)
+{
+    const float c1 = c1_;
+    const float c2 = c2_;
+    float       q  = prvq_;
+    float       r  = prvr_;
+    float       pa = prva_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        const float as = sig[i];
+        const float cs = comp[i];
+
+        q = c1 * as * as + c2 * q;
+        r = c1 * cs * cs + c2 * r;
+
+        const float a = q != 0.0f ? sqrtf(r / q) : sqrtf(r);
+
+        out[i] = (a - pa) != 0.0f ? as * pa : as * a;
+        pa     = a;
+    }
+
+    prvq_ = q;
+    prvr_ = r;
+    prva_ = pa;
+}
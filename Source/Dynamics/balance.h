@@ -4,6 +4,7 @@
 #define DSY_BALANCE_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -31,6 +32,17 @@ class Balance
     */
     float Process(float sig, float comp);
 
+    /** adjust a block of sig to the level of comp
+        \param sig - signal buffer, may be the same as out
+        \param comp - comparator buffer
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *sig,
+                      const float *comp,
+                      float *      out,
+                      size_t       size);
+
 
     /** adjusts the rate at which level compensation happens
         \param cutoff : Sets half power point of special internal cutoff filter.
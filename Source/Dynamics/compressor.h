@@ -179,13 +179,16 @@ class Compressor
 
     void RecalculateAttack()
     {
-        atk_slo_  = expf(-(sample_rate_inv_ / atk_));
-        atk_slo2_ = expf(-(sample_rate_inv2_ / atk_));
+        atk_slo_  = LutExp(-(sample_rate_inv_ / atk_));
+        atk_slo2_ = LutExp(-(sample_rate_inv2_ / atk_));
 
         RecalculateRatio();
     }
 
-    void RecalculateRelease() { rel_slo_ = expf((-(sample_rate_inv_ / rel_))); }
+    void RecalculateRelease()
+    {
+        rel_slo_ = LutExp((-(sample_rate_inv_ / rel_)));
+    }
 
     void RecalculateMakeup()
     {
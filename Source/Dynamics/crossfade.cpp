@@ -35,3 +35,37 @@ float CrossFade::Process(float &in1, float &in2)
         default: return 0;
     }
 }
+
+void CrossFade::ProcessBlock(const float *in1,
+                             const float *in2,
+                             float *      out,
+                             size_t       size)
+{
+    float scalar_1, scalar_2;
+    switch(curve_)
+    {
+        case CROSSFADE_LIN:
+            scalar_1 = pos_;
+            scalar_2 = 1.0f - scalar_1;
+            break;
+        case CROSSFADE_CPOW:
+            scalar_1 = sinf(pos_ * HALFPI_F);
+            scalar_2 = sinf((1.0f - pos_) * HALFPI_F);
+            break;
+        case CROSSFADE_LOG:
+            scalar_1
+                = expf(pos_ * (kCrossLogMax - kCrossLogMin) + kCrossLogMin);
+            scalar_2 = 1.0f - scalar_1;
+            break;
+        case CROSSFADE_EXP:
+            scalar_1 = pos_ * pos_;
+            scalar_2 = 1.0f - scalar_1;
+            break;
+        default: scalar_1 = scalar_2 = 0.0f; break;
+    }
+
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = (in1[i] * scalar_2) + (in2[i] * scalar_1);
+    }
+}
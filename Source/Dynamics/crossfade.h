@@ -2,6 +2,7 @@
 #ifndef DSY_CROSSFADE_H
 #define DSY_CROSSFADE_H
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -53,6 +54,17 @@ class CrossFade
     */
     float Process(float &in1, float &in2);
 
+    /** processes a block of samples with the current position and curve
+        \param in1 - first input buffer, may be the same as out
+        \param in2 - second input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in1,
+                      const float *in2,
+                      float *      out,
+                      size_t       size);
+
 
     /** Sets position of CrossFade between two input signals
         Input range: 0 to 1
@@ -3,6 +3,7 @@
 #define DSY_AUTOWAH_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -29,6 +30,13 @@ class Autowah
     */
     float Process(float in);
 
+    /** Processes a block of samples.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
 
     /** sets wah
         \param wah : set wah amount, , 0...1.0
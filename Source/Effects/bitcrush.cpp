@@ -32,3 +32,23 @@ float Bitcrush::Process(float in)
 
     return out;
 }
+
+void Bitcrush::ProcessBlock(const float *in, float *out, size_t size)
+{
+    const float bits    = pow(2, bit_depth_);
+    const float foldamt = sample_rate_ / crush_rate_;
+    const float scale   = bits / 65536.0f;
+    const float rescale = (65536.0f / bits) - 32768;
+
+    fold.SetIncrement(foldamt);
+    for(size_t i = 0; i < size; i++)
+    {
+        float s = in[i] * 65536.0f;
+        s += 32768;
+        s *= scale;
+        s = floor(s);
+        s *= rescale;
+        s      = fold.Process(s);
+        out[i] = s / 65536.0;
+    }
+}
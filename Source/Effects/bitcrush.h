@@ -3,6 +3,7 @@
 #define DSY_BITCRUSH_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -28,6 +29,13 @@ class Bitcrush
     */
     float Process(float in);
 
+    /** Processes a block of samples.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
 
     /** adjusts bitdepth
         \param bitdepth : Sets bit depth, 0...16
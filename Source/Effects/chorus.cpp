@@ -5,11 +5,18 @@
 using namespace daisysp;
 
 //ChorusEngine stuff
+#if !defined(DSY_DELAY_USER_MEMORY)
 void ChorusEngine::Init(float sample_rate)
+{
+    Init(sample_rate, buffer_, DSY_COUNTOF(buffer_));
+}
+#endif
+
+void ChorusEngine::Init(float sample_rate, float *buffer, size_t size)
 {
     sample_rate_ = sample_rate;
 
-    del_.Init();
+    del_.Init(buffer, size);
     lfo_amp_  = 0.f;
     feedback_ = .2f;
     SetDelay(.75);
@@ -30,6 +37,34 @@ float ChorusEngine::Process(float in)
     return (in + out) * .5f; //equal mix
 }
 
+void ChorusEngine::ProcessBlock(const float *in, float *out, size_t size)
+{
+    const float lfo_amp  = lfo_amp_;
+    const float delay    = delay_;
+    const float feedback = feedback_;
+    float       phase    = lfo_phase_;
+    float       freq     = lfo_freq_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        triangle_lfo(phase, freq);
+        del_.SetDelay(phase * lfo_amp + delay);
+
+        const float x   = in[i];
+        const float wet = del_.Read();
+        del_.Write(x + wet * feedback);
+        out[i] = (x + wet) * .5f;
+    }
+
+    lfo_phase_ = phase;
+    lfo_freq_  = freq;
+}
+
+size_t ChorusEngine::GetBufferSize(float sample_rate)
+{
+    return get_next_power2((size_t)(sample_rate * .05f) + 1);
+}
+
 void ChorusEngine::SetLfoDepth(float depth)
 {
     depth    = fclamp(depth, 0.f, .93f);
@@ -64,28 +99,29 @@ void ChorusEngine::SetFeedback(float feedback)
 
 float ChorusEngine::ProcessLfo()
 {
-    lfo_phase_ += lfo_freq_;
-
-    //wrap around and flip direction
-    if(lfo_phase_ > 1.f)
-    {
-        lfo_phase_ = 1.f - (lfo_phase_ - 1.f);
-        lfo_freq_ *= -1.f;
-    }
-    else if(lfo_phase_ < -1.f)
-    {
-        lfo_phase_ = -1.f - (lfo_phase_ + 1.f);
-        lfo_freq_ *= -1.f;
-    }
-
-    return lfo_phase_ * lfo_amp_;
+    return triangle_lfo(lfo_phase_, lfo_freq_) * lfo_amp_;
 }
 
 //Chorus Stuff
+#if !defined(DSY_DELAY_USER_MEMORY)
 void Chorus::Init(float sample_rate)
 {
     engines_[0].Init(sample_rate);
     engines_[1].Init(sample_rate);
+    Reset();
+}
+#endif
+
+void Chorus::Init(float sample_rate, float *buffer, size_t size)
+{
+    size /= 2;
+    engines_[0].Init(sample_rate, buffer, size);
+    engines_[1].Init(sample_rate, buffer + size, size);
+    Reset();
+}
+
+void Chorus::Reset()
+{
     SetPan(.25f, .75f);
 
     gain_frac_ = .5f;
@@ -110,6 +146,66 @@ float Chorus::Process(float in)
     return sigl_;
 }
 
+void Chorus::ProcessBlock(const float *in,
+                          float *      left,
+                          float *      right,
+                          size_t       size)
+{
+    // Mixed in the same order as Process(), so the output is identical
+    const float gain = gain_frac_;
+    const float pl0  = 1.f - pan_[0];
+    const float pl1  = 1.f - pan_[1];
+    const float pr0  = pan_[0];
+    const float pr1  = pan_[1];
+
+    float sig0[kChunkSize], sig1[kChunkSize];
+    for(size_t start = 0; start < size; start += kChunkSize)
+    {
+        const size_t n = DSY_MIN(kChunkSize, size - start);
+        engines_[0].ProcessBlock(in + start, sig0, n);
+        engines_[1].ProcessBlock(in + start, sig1, n);
+        for(size_t i = 0; i < n; i++)
+        {
+            left[start + i]  = (pl0 * sig0[i] + pl1 * sig1[i]) * gain;
+            right[start + i] = (pr0 * sig0[i] + pr1 * sig1[i]) * gain;
+        }
+    }
+
+    if(size > 0)
+    {
+        sigl_ = left[size - 1];
+        sigr_ = right[size - 1];
+    }
+}
+
+void Chorus::ProcessBlock(const float *in, float *out, size_t size)
+{
+    // Mixed in the same order as Process(), so the output is identical
+    const float gain = gain_frac_;
+    const float pl0  = 1.f - pan_[0];
+    const float pl1  = 1.f - pan_[1];
+    const float pr0  = pan_[0];
+    const float pr1  = pan_[1];
+
+    float sig0[kChunkSize], sig1[kChunkSize];
+    for(size_t start = 0; start < size; start += kChunkSize)
+    {
+        const size_t n = DSY_MIN(kChunkSize, size - start);
+        engines_[0].ProcessBlock(in + start, sig0, n);
+        engines_[1].ProcessBlock(in + start, sig1, n);
+        for(size_t i = 0; i < n; i++)
+        {
+            out[start + i] = (pl0 * sig0[i] + pl1 * sig1[i]) * gain;
+        }
+        sigr_ = (pr0 * sig0[n - 1] + pr1 * sig1[n - 1]) * gain;
+    }
+
+    if(size > 0)
+    {
+        sigl_ = out[size - 1];
+    }
+}
+
 float Chorus::GetLeft()
 {
     return sigl_;
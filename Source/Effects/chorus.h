@@ -4,6 +4,7 @@
 #ifdef __cplusplus
 
 #include <stdint.h>
+#include <stddef.h>
 #include "Utility/delayline.h"
 
 /** @file chorus.h */
@@ -20,16 +21,38 @@ class ChorusEngine
     ChorusEngine() {}
     ~ChorusEngine() {}
 
-    /** Initialize the module
+#if !defined(DSY_DELAY_USER_MEMORY)
+    /** Initialize the module with its built-in 50 ms at 48kHz delay memory.
         \param sample_rate Audio engine sample rate.
     */
     void Init(float sample_rate);
+#endif
+
+    /** Initialize the module with user-provided delay memory.
+        Only the largest power of two that fits in size is used.
+        \param sample_rate Audio engine sample rate.
+        \param buffer Delay memory, must outlive the engine.
+        \param size Length of buffer in samples, see GetBufferSize().
+    */
+    void Init(float sample_rate, float *buffer, size_t size);
+
+    /** Returns the delay memory in samples that holds the full 50 ms
+        delay range at sample_rate.
+    */
+    static size_t GetBufferSize(float sample_rate);
 
     /** Get the next sample
         \param in Sample to process
     */
     float Process(float in);
 
+    /** Processes a block of samples.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
     /** How much to modulate the delay by.
         \param depth Works 0-1.
     */
@@ -69,7 +92,10 @@ class ChorusEngine
 
     float delay_;
 
-    DelayLine<float, kDelayLength> del_;
+    DelayLine<float, DELAYLINE_USER_MEMORY, true> del_;
+#if !defined(DSY_DELAY_USER_MEMORY)
+    float buffer_[delayline_detail::NextPower2(kDelayLength)];
+#endif
 
     float ProcessLfo();
 };
@@ -88,16 +114,50 @@ class Chorus
     Chorus() {}
     ~Chorus() {}
 
-    /** Initialize the module
+#if !defined(DSY_DELAY_USER_MEMORY)
+    /** Initialize the module with its built-in delay memory.
         \param sample_rate Audio engine sample rate
     */
     void Init(float sample_rate);
+#endif
+
+    /** Initialize the module with user-provided delay memory, shared
+        evenly between the two engines.
+        \param sample_rate Audio engine sample rate
+        \param buffer Delay memory, must outlive the module.
+        \param size Length of buffer in samples, see GetBufferSize().
+    */
+    void Init(float sample_rate, float *buffer, size_t size);
+
+    /** Returns the delay memory in samples needed by Init() for the full
+        delay range at sample_rate.
+    */
+    static size_t GetBufferSize(float sample_rate)
+    {
+        return 2 * ChorusEngine::GetBufferSize(sample_rate);
+    }
 
     /** Get the net floating point sample. Defaults to left channel.
         \param in Sample to process
     */
     float Process(float in);
 
+    /** Processes a block of samples into both channels.
+        \param in - input buffer, may be the same as left or right
+        \param left - left channel output buffer
+        \param right - right channel output buffer
+        \param size - number of samples to process
+    */
+    void
+    ProcessBlock(const float *in, float *left, float *right, size_t size);
+
+    /** Processes a block of samples. Defaults to left channel.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
     /** Get the left channel's last sample */
     float GetLeft();
 
@@ -171,11 +231,15 @@ class Chorus
     void SetFeedback(float feedback);
 
   private:
+    static constexpr size_t kChunkSize = 32;
+
     ChorusEngine engines_[2];
     float        gain_frac_;
     float        pan_[2];
 
     float sigl_, sigr_;
+
+    void Reset();
 };
 } //namespace daisysp
 #endif
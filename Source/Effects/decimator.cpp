@@ -30,3 +30,35 @@ float Decimator::Process(float input)
     bitcrushed_ = (float)temp / 65536.0f;
     return bitcrushed_;
 }
+
+void Decimator::ProcessBlock(const float *in, float *out, size_t size)
+{
+    threshold_ = (uint32_t)((downsample_factor_ * downsample_factor_) * 96.0f);
+
+    const uint32_t threshold   = threshold_;
+    const uint32_t shift       = bits_to_crush_;
+    uint32_t       inc         = inc_;
+    float          downsampled = downsampled_;
+    int32_t        temp        = 0;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        inc += 1;
+        if(inc > threshold)
+        {
+            inc         = 0;
+            downsampled = in[i];
+        }
+        temp = (int32_t)(downsampled * 65536.0f);
+        temp >>= shift;
+        temp <<= shift;
+        out[i] = (float)temp / 65536.0f;
+    }
+
+    inc_         = inc;
+    downsampled_ = downsampled;
+    if(size > 0)
+    {
+        bitcrushed_ = out[size - 1];
+    }
+}
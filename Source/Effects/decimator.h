@@ -3,6 +3,7 @@
 #ifndef DECIMATOR_H
 #define DECIMATOR_H
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -23,6 +24,13 @@ class Decimator
     */
     float Process(float input);
 
+    /** Processes a block of samples.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
 
     /** Sets amount of downsample 
         Input range: 
@@ -0,0 +1,475 @@
+#pragma once
+#ifndef DSY_FDNREVERB_H
+#define DSY_FDNREVERB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include "Utility/dsp.h"
+#include "Utility/simd.h"
+#ifdef __cplusplus
+
+/** @file fdnreverb.h */
+
+namespace daisysp
+{
+/** Stereo feedback delay network reverb with num_lines delay lines.
+
+    Each line is damped by a one pole lowpass, as in ReverbSc, and the
+    lines feed back into each other through an orthogonal mixing matrix:
+    a fast Walsh-Hadamard transform (N log N adds) or a Householder
+    reflection (2N adds). More lines give a denser echo pattern sooner,
+    at a roughly proportional cost in CPU and memory, so the line count
+    can be picked per deployment.
+
+    The line lengths are primes spread geometrically between 25 and 95 ms.
+    They are fixed, there is no modulation. The left input feeds the even
+    lines and the right input the odd ones, and the outputs are tapped the
+    same way.
+
+    Processing runs in chunks of up to 48 frames, shorter than any line, so
+    each line is read and written once per chunk and the math runs on
+    vectors along time (see Utility/simd.h).
+
+    The delay memory is always user-provided:
+
+    FdnReverb<16> verb;
+    size_t        size = FdnReverb<16>::GetBufferSize(sample_rate);
+    verb.Init(sample_rate, arena.Allocate<float>(size), size);
+
+    \param num_lines - number of delay lines, 4, 8, 16 or 32.
+*/
+template <size_t num_lines>
+class FdnReverb
+{
+  public:
+    static_assert(num_lines == 4 || num_lines == 8 || num_lines == 16
+                      || num_lines == 32,
+                  "FdnReverb: number of lines must be 4, 8, 16 or 32");
+
+    /** Feedback matrices */
+    enum
+    {
+        MATRIX_HADAMARD,
+        MATRIX_HOUSEHOLDER,
+        MATRIX_LAST,
+    };
+
+    FdnReverb() {}
+    ~FdnReverb() {}
+
+    /** Initializes the reverb
+        \param sample_rate - sample rate of the audio engine being run
+        \param buffer - delay memory, must outlive the reverb
+        \param size - length of buffer in samples, see GetBufferSize()
+        \return false if the buffer is too small for sample_rate. The
+        reverb then has no lines and must not be processed.
+
+        Defaults:
+        - feedback = 0.85
+        - lowpass frequency = 10 kHz
+        - matrix = MATRIX_HADAMARD
+    */
+    bool Init(float sample_rate, float *buffer, size_t size)
+    {
+        sample_rate_ = sample_rate;
+        feedback_    = 0.85f;
+        lpfreq_      = 10000.f;
+        matrix_      = MATRIX_HADAMARD;
+        if(buffer == nullptr || size < GetBufferSize(sample_rate))
+        {
+            for(size_t n = 0; n < num_lines; n++)
+            {
+                line_[n]  = nullptr;
+                len_[n]   = 0;
+                pos_[n]   = 0;
+                gain_[n]  = 0.f;
+                state_[n] = 0.f;
+            }
+            damp_     = 0.f;
+            out_gain_ = 0.f;
+            return false;
+        }
+
+        size_t offset = 0;
+        for(size_t n = 0; n < num_lines; n++)
+        {
+            len_[n]  = LineLength(sample_rate, n, n > 0 ? len_[n - 1] : 0);
+            line_[n] = buffer + offset;
+            offset += len_[n];
+        }
+        Clear();
+        UpdateGains();
+        return true;
+    }
+
+    /** Returns the delay memory in samples needed at sample_rate */
+    static size_t GetBufferSize(float sample_rate)
+    {
+        size_t size = 0, len = 0;
+        for(size_t n = 0; n < num_lines; n++)
+        {
+            len = LineLength(sample_rate, n, len);
+            size += len;
+        }
+        return size;
+    }
+
+    /** Silences the delay lines */
+    void Clear()
+    {
+        for(size_t n = 0; n < num_lines; n++)
+        {
+            memset(line_[n], 0, len_[n] * sizeof(float));
+            pos_[n]   = 0;
+            state_[n] = 0.f;
+        }
+    }
+
+    /** Sets the feedback gain for 100 ms of delay, longer lines get less.
+        \param fb - 0.0 to 1.0, the tail becomes infinite at 1.0
+    */
+    void SetFeedback(float fb)
+    {
+        feedback_ = fclamp(fb, 0.f, 1.f);
+        UpdateGains();
+    }
+
+    /** Sets the cutoff of the lowpass filters in the feedback paths
+        \param freq - cutoff in Hz
+    */
+    void SetLpFreq(float freq)
+    {
+        lpfreq_ = freq;
+        UpdateGains();
+    }
+
+    /** Sets the feedback matrix
+        \param matrix - one of MATRIX_, Hadamard if out of range
+    */
+    void SetMatrix(uint8_t matrix)
+    {
+        matrix_ = matrix < MATRIX_LAST ? matrix : (uint8_t)MATRIX_HADAMARD;
+        UpdateGains();
+    }
+
+    /** Processes one stereo frame, ProcessBlock() is more efficient */
+    void Process(float in1, float in2, float *out1, float *out2)
+    {
+        float s[num_lines], left = 0.f, right = 0.f;
+        for(size_t n = 0; n < num_lines; n++)
+        {
+            s[n] = line_[n][pos_[n]];
+        }
+        // same vector math as ProcessChunk(), so a compiler that fuses the
+        // multiply and add does it the same way in both
+        const Vec4 damp(damp_);
+        for(size_t n = 0; n < num_lines; n += 4)
+        {
+            const Vec4 x     = Vec4::Load(s + n);
+            const Vec4 gain  = Vec4::Load(gain_ + n);
+            Vec4       state = Vec4::Load(state_ + n);
+            state            = state * damp + gain * x;
+            state.Store(state_ + n);
+            state.Store(s + n);
+        }
+        for(size_t n = 0; n < num_lines; n += 2)
+        {
+            left += s[n];
+            right += s[n + 1];
+        }
+        *out1 = left * out_gain_;
+        *out2 = right * out_gain_;
+
+        if(matrix_ == MATRIX_HADAMARD)
+        {
+            for(size_t h = 1; h < num_lines; h *= 2)
+            {
+                for(size_t n = 0; n < num_lines; n += 2 * h)
+                {
+                    for(size_t m = n; m < n + h; m++)
+                    {
+                        const float x = s[m];
+                        s[m]          = x + s[m + h];
+                        s[m + h]      = x - s[m + h];
+                    }
+                }
+            }
+        }
+        else
+        {
+            float sum = 0.f;
+            for(size_t n = 0; n < num_lines; n++)
+            {
+                sum += s[n];
+            }
+            sum *= 2.f / num_lines;
+            for(size_t n = 0; n < num_lines; n++)
+            {
+                s[n] -= sum;
+            }
+        }
+
+        for(size_t n = 0; n < num_lines; n++)
+        {
+            line_[n][pos_[n]] = s[n] + (n & 1 ? in2 : in1);
+            pos_[n]           = pos_[n] + 1 < len_[n] ? pos_[n] + 1 : 0;
+        }
+    }
+
+    /** Processes a block of stereo samples
+        \param in1 - left input buffer, may be the same as out1
+        \param in2 - right input buffer, may be the same as out2
+        \param out1 - left output buffer
+        \param out2 - right output buffer
+        \param size - number of frames to process
+    */
+    void ProcessBlock(const float *in1,
+                      const float *in2,
+                      float *      out1,
+                      float *      out2,
+                      size_t       size)
+    {
+        while(size > 0)
+        {
+            const size_t todo = size < kChunk ? size : kChunk;
+            if(todo < 8)
+            {
+                // too short to pay for the setup
+                for(size_t i = 0; i < todo; i++)
+                {
+                    Process(in1[i], in2[i], out1 + i, out2 + i);
+                }
+            }
+            else
+            {
+                ProcessChunk(in1, in2, out1, out2, todo);
+            }
+            in1 += todo;
+            in2 += todo;
+            out1 += todo;
+            out2 += todo;
+            size -= todo;
+        }
+    }
+
+    /** Returns the length of a delay line in samples */
+    inline size_t GetLineLength(size_t line) const { return len_[line]; }
+
+  private:
+    typedef simd::FloatVec<simd::kNativeWidth> Vec;
+    typedef simd::FloatVec<4>                  Vec4;
+
+    static constexpr size_t kWidth      = simd::kNativeWidth;
+    static constexpr size_t kChunk      = 48;
+    static constexpr float  kMinDelay   = 0.025f;
+    static constexpr float  kMaxDelay   = 0.095f;
+    static constexpr float  kRefDelay   = 0.1f;
+    static constexpr float  kOutputGain = 0.35f;
+
+    /** Length of line n, the first prime after its spot on the geometric
+        spread and after prev, the length of line n - 1 */
+    static size_t LineLength(float sample_rate, size_t n, size_t prev)
+    {
+        const float ratio = (float)n / (float)(num_lines - 1);
+        size_t      len   = (size_t)(sample_rate * kMinDelay
+                                * powf(kMaxDelay / kMinDelay, ratio));
+        len               = len > prev ? len : prev + 1;
+        len               = len > kChunk ? len : kChunk;
+        while(!IsPrime(len))
+            len++;
+        return len;
+    }
+
+    static bool IsPrime(size_t n)
+    {
+        if(n < 4)
+            return n > 1;
+        if(n % 2 == 0)
+            return false;
+        for(size_t d = 3; d * d <= n; d += 2)
+        {
+            if(n % d == 0)
+                return false;
+        }
+        return true;
+    }
+
+    /** Folds feedback, lowpass input gain and matrix scale into one gain
+        per line */
+    void UpdateGains()
+    {
+        float damp = 2.f - cosf(lpfreq_ * TWOPI_F / sample_rate_);
+        damp       = damp - sqrtf(damp * damp - 1.f);
+        damp_      = damp;
+
+        // the Hadamard transform below is not normalized
+        const float scale
+            = matrix_ == MATRIX_HADAMARD ? 1.f / sqrtf((float)num_lines) : 1.f;
+        for(size_t n = 0; n < num_lines; n++)
+        {
+            const float delay = (float)len_[n] / (sample_rate_ * kRefDelay);
+            gain_[n]          = powf(feedback_, delay) * (1.f - damp) * scale;
+        }
+        out_gain_ = kOutputGain / (scale * sqrtf(num_lines * .5f));
+    }
+
+    void ProcessChunk(const float *in1,
+                      const float *in2,
+                      float *      out1,
+                      float *      out2,
+                      size_t       todo)
+    {
+        // vector loops run over whole vectors, the padding is discarded
+        const size_t padded = (todo + kWidth - 1) / kWidth * kWidth;
+
+        // read, every line is at least kChunk long, so nothing written in
+        // this chunk is read back in it
+        for(size_t n = 0; n < num_lines; n++)
+        {
+            const float *line  = line_[n];
+            const size_t pos   = pos_[n];
+            const size_t first = DSY_MIN(todo, len_[n] - pos);
+            for(size_t i = 0; i < first; i++)
+            {
+                block_[n][i] = line[pos + i];
+            }
+            for(size_t i = first; i < padded; i++)
+            {
+                block_[n][i] = i < todo ? line[i - first] : 0.f;
+            }
+        }
+
+        // lowpass filters, four lines per vector, transposed from and to
+        // vectors along time
+        const Vec4 damp(damp_);
+        for(size_t n = 0; n < num_lines; n += 4)
+        {
+            const Vec4 gain = Vec4::Load(gain_ + n);
+            Vec4       s    = Vec4::Load(state_ + n);
+            for(size_t i = 0; i < padded; i += 4)
+            {
+                Vec4 x0 = Vec4::Load(&block_[n][i]);
+                Vec4 x1 = Vec4::Load(&block_[n + 1][i]);
+                Vec4 x2 = Vec4::Load(&block_[n + 2][i]);
+                Vec4 x3 = Vec4::Load(&block_[n + 3][i]);
+                Transpose(x0, x1, x2, x3);
+                x0 = s = s * damp + gain * x0;
+                x1 = s = s * damp + gain * x1;
+                x2 = s = s * damp + gain * x2;
+                x3 = s = s * damp + gain * x3;
+                Transpose(x0, x1, x2, x3);
+                x0.Store(&block_[n][i]);
+                x1.Store(&block_[n + 1][i]);
+                x2.Store(&block_[n + 2][i]);
+                x3.Store(&block_[n + 3][i]);
+            }
+            for(size_t k = 0; k < 4; k++)
+            {
+                state_[n + k] = block_[n + k][todo - 1];
+            }
+        }
+
+        // output taps
+        for(size_t i = 0; i < padded; i += kWidth)
+        {
+            Vec left(0.f), right(0.f);
+            for(size_t n = 0; n < num_lines; n += 2)
+            {
+                left  = left + Vec::Load(&block_[n][i]);
+                right = right + Vec::Load(&block_[n + 1][i]);
+            }
+            (left * out_gain_).Store(&out_[0][i]);
+            (right * out_gain_).Store(&out_[1][i]);
+        }
+
+        // feedback matrix
+        if(matrix_ == MATRIX_HADAMARD)
+        {
+            for(size_t h = 1; h < num_lines; h *= 2)
+            {
+                for(size_t n = 0; n < num_lines; n += 2 * h)
+                {
+                    for(size_t m = n; m < n + h; m++)
+                    {
+                        Butterfly(block_[m], block_[m + h], padded);
+                    }
+                }
+            }
+        }
+        else
+        {
+            const float k = 2.f / num_lines;
+            for(size_t i = 0; i < padded; i += kWidth)
+            {
+                Vec sum(0.f);
+                for(size_t n = 0; n < num_lines; n++)
+                {
+                    sum = sum + Vec::Load(&block_[n][i]);
+                }
+                sum = sum * k;
+                for(size_t n = 0; n < num_lines; n++)
+                {
+                    (Vec::Load(&block_[n][i]) - sum).Store(&block_[n][i]);
+                }
+            }
+        }
+
+        // add the inputs and write back
+        for(size_t i = 0; i < padded; i++)
+        {
+            in_[0][i] = i < todo ? in1[i] : 0.f;
+            in_[1][i] = i < todo ? in2[i] : 0.f;
+        }
+        for(size_t n = 0; n < num_lines; n++)
+        {
+            const float *in = in_[n & 1];
+            for(size_t i = 0; i < padded; i += kWidth)
+            {
+                (Vec::Load(&block_[n][i]) + Vec::Load(in + i))
+                    .Store(&block_[n][i]);
+            }
+            float *      line  = line_[n];
+            const size_t pos   = pos_[n];
+            const size_t first = DSY_MIN(todo, len_[n] - pos);
+            for(size_t i = 0; i < first; i++)
+            {
+                line[pos + i] = block_[n][i];
+            }
+            for(size_t i = first; i < todo; i++)
+            {
+                line[i - first] = block_[n][i];
+            }
+            pos_[n] = pos + todo < len_[n] ? pos + todo : pos + todo - len_[n];
+        }
+
+        for(size_t i = 0; i < todo; i++)
+        {
+            out1[i] = out_[0][i];
+            out2[i] = out_[1][i];
+        }
+    }
+
+    static inline void Butterfly(float *a, float *b, size_t size)
+    {
+        for(size_t i = 0; i < size; i += kWidth)
+        {
+            const Vec x = Vec::Load(a + i);
+            const Vec y = Vec::Load(b + i);
+            (x + y).Store(a + i);
+            (x - y).Store(b + i);
+        }
+    }
+
+    float   sample_rate_, feedback_, lpfreq_, damp_, out_gain_;
+    uint8_t matrix_;
+    float * line_[num_lines];
+    size_t  len_[num_lines], pos_[num_lines];
+    float   gain_[num_lines], state_[num_lines];
+    float   block_[num_lines][kChunk];
+    float   in_[2][kChunk], out_[2][kChunk];
+};
+} // namespace daisysp
+#endif
+#endif
@@ -4,13 +4,20 @@
 
 using namespace daisysp;
 
+#if !defined(DSY_DELAY_USER_MEMORY)
 void Flanger::Init(float sample_rate)
+{
+    Init(sample_rate, buffer_, DSY_COUNTOF(buffer_));
+}
+#endif
+
+void Flanger::Init(float sample_rate, float *buffer, size_t size)
 {
     sample_rate_ = sample_rate;
 
     SetFeedback(.2f);
 
-    del_.Init();
+    del_.Init(buffer, size);
     lfo_amp_ = 0.f;
     SetDelay(.75);
 
@@ -30,12 +37,40 @@ float Flanger::Process(float in)
     return (in + out) * .5f; //equal mix
 }
 
+void Flanger::ProcessBlock(const float *in, float *out, size_t size)
+{
+    const float lfo_amp  = lfo_amp_;
+    const float delay    = delay_;
+    const float feedback = feedback_;
+    float       phase    = lfo_phase_;
+    float       freq     = lfo_freq_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        triangle_lfo(phase, freq);
+        del_.SetDelay(1.f + phase * lfo_amp + delay);
+
+        const float x   = in[i];
+        const float wet = del_.Read();
+        del_.Write(x + wet * feedback);
+        out[i] = (x + wet) * .5f;
+    }
+
+    lfo_phase_ = phase;
+    lfo_freq_  = freq;
+}
+
 void Flanger::SetFeedback(float feedback)
 {
     feedback_ = fclamp(feedback, 0.f, 1.f);
     feedback_ *= .97f;
 }
 
+size_t Flanger::GetBufferSize(float sample_rate)
+{
+    return get_next_power2((size_t)(sample_rate * .02f) + 1);
+}
+
 void Flanger::SetLfoDepth(float depth)
 {
     depth    = fclamp(depth, 0.f, .93f);
@@ -65,19 +100,5 @@ void Flanger::SetDelayMs(float ms)
 
 float Flanger::ProcessLfo()
 {
-    lfo_phase_ += lfo_freq_;
-
-    //wrap around and flip direction
-    if(lfo_phase_ > 1.f)
-    {
-        lfo_phase_ = 1.f - (lfo_phase_ - 1.f);
-        lfo_freq_ *= -1.f;
-    }
-    else if(lfo_phase_ < -1.f)
-    {
-        lfo_phase_ = -1.f - (lfo_phase_ + 1.f);
-        lfo_freq_ *= -1.f;
-    }
-
-    return lfo_phase_ * lfo_amp_;
+    return triangle_lfo(lfo_phase_, lfo_freq_) * lfo_amp_;
 }
\ No newline at end of file
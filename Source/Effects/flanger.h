@@ -4,6 +4,7 @@
 #ifdef __cplusplus
 
 #include <stdint.h>
+#include <stddef.h>
 #include "Utility/delayline.h"
 
 /** @file flanger.h */
@@ -18,16 +19,38 @@ namespace daisysp
 class Flanger
 {
   public:
-    /** Initialize the modules
+#if !defined(DSY_DELAY_USER_MEMORY)
+    /** Initialize the modules with the built-in 20 ms at 48kHz delay memory.
         \param sample_rate Audio engine sample rate.
     */
     void Init(float sample_rate);
+#endif
+
+    /** Initialize the modules with user-provided delay memory.
+        Only the largest power of two that fits in size is used.
+        \param sample_rate Audio engine sample rate.
+        \param buffer Delay memory, must outlive the flanger.
+        \param size Length of buffer in samples, see GetBufferSize().
+    */
+    void Init(float sample_rate, float *buffer, size_t size);
+
+    /** Returns the delay memory in samples that holds the full 20 ms
+        delay range at sample_rate.
+    */
+    static size_t GetBufferSize(float sample_rate);
 
     /** Get the next sample
         \param in Sample to process
     */
     float Process(float in);
 
+    /** Processes a block of samples.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
     /** How much of the signal to feedback into the delay line.
         \param feedback Works 0-1.
     */
@@ -66,7 +89,10 @@ class Flanger
 
     float delay_;
 
-    DelayLine<float, kDelayLength> del_;
+    DelayLine<float, DELAYLINE_USER_MEMORY, true> del_;
+#if !defined(DSY_DELAY_USER_MEMORY)
+    float buffer_[delayline_detail::NextPower2(kDelayLength)];
+#endif
 
     float ProcessLfo();
 };
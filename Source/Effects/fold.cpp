@@ -29,3 +29,26 @@ float Fold::Process(float in)
     sample_index_++;
     return out;
 }
+
+void Fold::ProcessBlock(const float *in, float *out, size_t size)
+{
+    const float incr         = incr_;
+    float       index        = index_;
+    float       value        = value_;
+    int         sample_index = sample_index_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        if(index < sample_index)
+        {
+            index += incr;
+            value = in[i];
+        }
+        out[i] = value;
+        sample_index++;
+    }
+
+    index_        = index;
+    value_        = value;
+    sample_index_ = sample_index;
+}
@@ -29,4 +29,15 @@ void Overdrive::SetDrive(float drive)
     post_gain_ = 1.0f / SoftClip(0.33f + drive_squashed * (pre_gain_ - 0.33f));
 }
 
+void Overdrive::ProcessBlock(const float *in, float *out, size_t size)
+{
+    const float pre_gain  = pre_gain_;
+    const float post_gain = post_gain_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = SoftClip(pre_gain * in[i]) * post_gain;
+    }
+}
+
 } // namespace daisysp
\ No newline at end of file
@@ -3,6 +3,7 @@
 #define DSY_OVERDRIVE_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 /** @file overdrive.h */
@@ -31,6 +32,13 @@ class Overdrive
     */
     float Process(float in);
 
+    /** Processes a block of samples.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
     /** Set the amount of drive
           \param drive Works from 0-1
       */
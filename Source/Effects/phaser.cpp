@@ -5,11 +5,18 @@
 using namespace daisysp;
 
 //PhaserEngine stuff
+#if !defined(DSY_DELAY_USER_MEMORY)
 void PhaserEngine::Init(float sample_rate)
+{
+    Init(sample_rate, buffer_, DSY_COUNTOF(buffer_));
+}
+#endif
+
+void PhaserEngine::Init(float sample_rate, float *buffer, size_t size)
 {
     sample_rate_ = sample_rate;
 
-    del_.Init();
+    del_.Init(buffer, size);
     lfo_amp_  = 0.f;
     feedback_ = .2f;
     SetFreq(200.f);
@@ -35,6 +42,40 @@ float PhaserEngine::Process(float in)
     return (in + last_sample_) * .5f; //equal mix
 }
 
+void PhaserEngine::ProcessBlock(const float *in, float *out, size_t size)
+{
+    const float sr       = sample_rate_;
+    const float lfo_amp  = lfo_amp_;
+    const float ap_freq  = ap_freq_;
+    const float os       = os_;
+    const float feedback = feedback_;
+    float       phase    = lfo_phase_;
+    float       freq     = lfo_freq_;
+    float       deltime  = deltime_;
+    float       last     = last_sample_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        triangle_lfo(phase, freq);
+        const float lfo_sig = phase * lfo_amp * ap_freq;
+        fonepole(deltime, sr / (lfo_sig + ap_freq + os), .0001f);
+
+        const float x = in[i];
+        last          = del_.Allpass(x + feedback * last, deltime, .3f);
+        out[i]        = (x + last) * .5f;
+    }
+
+    lfo_phase_   = phase;
+    lfo_freq_    = freq;
+    deltime_     = deltime;
+    last_sample_ = last;
+}
+
+size_t PhaserEngine::GetBufferSize(float sample_rate)
+{
+    return get_next_power2((size_t)(sample_rate * .05f) + 1);
+}
+
 void PhaserEngine::SetLfoDepth(float depth)
 {
     lfo_amp_ = fclamp(depth, 0.f, 1.f);
@@ -59,31 +100,33 @@ void PhaserEngine::SetFeedback(float feedback)
 
 float PhaserEngine::ProcessLfo()
 {
-    lfo_phase_ += lfo_freq_;
-
-    //wrap around and flip direction
-    if(lfo_phase_ > 1.f)
-    {
-        lfo_phase_ = 1.f - (lfo_phase_ - 1.f);
-        lfo_freq_ *= -1.f;
-    }
-    else if(lfo_phase_ < -1.f)
-    {
-        lfo_phase_ = -1.f - (lfo_phase_ + 1.f);
-        lfo_freq_ *= -1.f;
-    }
-
-    return lfo_phase_ * lfo_amp_ * ap_freq_;
+    return triangle_lfo(lfo_phase_, lfo_freq_) * lfo_amp_ * ap_freq_;
 }
 
 //Phaser Stuff
+#if !defined(DSY_DELAY_USER_MEMORY)
 void Phaser::Init(float sample_rate)
 {
     for(size_t i = 0; i < kMaxPoles; i++)
     {
         engines_[i].Init(sample_rate);
     }
+    Reset();
+}
+#endif
+
+void Phaser::Init(float sample_rate, float *buffer, size_t size)
+{
+    size /= kMaxPoles;
+    for(size_t i = 0; i < kMaxPoles; i++)
+    {
+        engines_[i].Init(sample_rate, buffer + i * size, size);
+    }
+    Reset();
+}
 
+void Phaser::Reset()
+{
     poles_     = 4;
     gain_frac_ = .5f;
 }
@@ -100,6 +143,28 @@ float Phaser::Process(float in)
     return sig;
 }
 
+void Phaser::ProcessBlock(const float *in, float *out, size_t size)
+{
+    float sig[kChunkSize], sum[kChunkSize];
+    for(size_t start = 0; start < size; start += kChunkSize)
+    {
+        const size_t n = DSY_MIN(kChunkSize, size - start);
+        engines_[0].ProcessBlock(in + start, sum, n);
+        for(int p = 1; p < poles_; p++)
+        {
+            engines_[p].ProcessBlock(in + start, sig, n);
+            for(size_t i = 0; i < n; i++)
+            {
+                sum[i] += sig[i];
+            }
+        }
+        for(size_t i = 0; i < n; i++)
+        {
+            out[start + i] = sum[i];
+        }
+    }
+}
+
 void Phaser::SetPoles(int poles)
 {
     poles_ = DSY_CLAMP(poles, 1, 8);
@@ -4,6 +4,7 @@
 #ifdef __cplusplus
 
 #include <stdint.h>
+#include <stddef.h>
 #include "Utility/delayline.h"
 
 /** @file phaser.h */
@@ -20,16 +21,38 @@ class PhaserEngine
     PhaserEngine() {}
     ~PhaserEngine() {}
 
-    /** Initialize the module
+#if !defined(DSY_DELAY_USER_MEMORY)
+    /** Initialize the module with its built-in 50 ms at 48kHz delay memory.
         \param sample_rate Audio engine sample rate.
     */
     void Init(float sample_rate);
+#endif
+
+    /** Initialize the module with user-provided delay memory.
+        Only the largest power of two that fits in size is used.
+        \param sample_rate Audio engine sample rate.
+        \param buffer Delay memory, must outlive the engine.
+        \param size Length of buffer in samples, see GetBufferSize().
+    */
+    void Init(float sample_rate, float *buffer, size_t size);
+
+    /** Returns the delay memory in samples that holds the full 50 ms
+        delay range at sample_rate.
+    */
+    static size_t GetBufferSize(float sample_rate);
 
     /** Get the next sample
         \param in Sample to process
     */
     float Process(float in);
 
+    /** Processes a block of samples.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
     /** How much to modulate the allpass filter by.
         \param depth Works 0-1.
     */
@@ -68,7 +91,10 @@ class PhaserEngine
     float deltime_;
     float last_sample_;
 
-    DelayLine<float, kDelayLength> del_;
+    DelayLine<float, DELAYLINE_USER_MEMORY, true> del_;
+#if !defined(DSY_DELAY_USER_MEMORY)
+    float buffer_[delayline_detail::NextPower2(kDelayLength)];
+#endif
 
     float ProcessLfo();
 };
@@ -85,16 +111,41 @@ class Phaser
     Phaser() {}
     ~Phaser() {}
 
-    /** Initialize the module
+#if !defined(DSY_DELAY_USER_MEMORY)
+    /** Initialize the module with its built-in delay memory.
         \param sample_rate Audio engine sample rate
     */
     void Init(float sample_rate);
+#endif
+
+    /** Initialize the module with user-provided delay memory, shared
+        evenly between the eight allpass engines.
+        \param sample_rate Audio engine sample rate
+        \param buffer Delay memory, must outlive the module.
+        \param size Length of buffer in samples, see GetBufferSize().
+    */
+    void Init(float sample_rate, float *buffer, size_t size);
+
+    /** Returns the delay memory in samples needed by Init() for the full
+        delay range at sample_rate.
+    */
+    static size_t GetBufferSize(float sample_rate)
+    {
+        return kMaxPoles * PhaserEngine::GetBufferSize(sample_rate);
+    }
 
     /** Get the next floating point sample.
         \param in Sample to process
     */
     float Process(float in);
 
+    /** Processes a block of samples.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
     /** Number of allpass stages.
         \param poles Works 1 to 8.
     */
@@ -121,10 +172,13 @@ class Phaser
     void SetFeedback(float feedback);
 
   private:
-    static constexpr int kMaxPoles = 8;
-    PhaserEngine         engines_[kMaxPoles];
-    float                gain_frac_;
-    int                  poles_;
+    static constexpr int    kMaxPoles  = 8;
+    static constexpr size_t kChunkSize = 32;
+    PhaserEngine            engines_[kMaxPoles];
+    float                   gain_frac_;
+    int                     poles_;
+
+    void Reset();
 };
 } //namespace daisysp
 #endif
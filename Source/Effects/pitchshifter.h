@@ -8,6 +8,7 @@
 #endif
 #include "Utility/dsp.h"
 #include "Utility/delayline.h"
+#include "Utility/random.h"
 #include "Control/phasor.h"
 
 /** Shift can be 30-100 ms lets just start with 50 for now.
@@ -20,21 +21,6 @@
 
 namespace daisysp
 {
-static inline uint32_t hash_xs32(uint32_t x)
-{
-    x ^= x << 13;
-    x ^= x >> 17;
-    x ^= x << 5;
-    return x;
-}
-
-inline uint32_t myrand()
-{
-    static uint32_t seed = 1;
-    seed                 = hash_xs32(seed);
-    return seed;
-}
-
 /**  time-domain pitchshifter
 
 Author: shensley
@@ -50,34 +36,54 @@ where:
 
 solving for t = 12.0
 f = (12 - 1) * 48000 / SHIFT_BUFFER_SIZE;
-
-\todo - move hash_xs32 and myrand to dsp.h and give appropriate names
 */
 class PitchShifter
 {
   public:
     PitchShifter() {}
     ~PitchShifter() {}
+#if !defined(DSY_DELAY_USER_MEMORY)
     /** Initialize pitch shifter
     */
-    void Init(float sr)
+    void Init(float sr) { Init(sr, buffer_[0], 2 * SHIFT_BUFFER_SIZE); }
+#endif
+
+    /** Initialize pitch shifter with user-provided delay memory, shared
+        by its two delay lines. Each line uses the largest power of two
+        that fits in half of size.
+        \param sr - sample rate
+        \param buffer - delay memory, must outlive the pitch shifter
+        \param size - length of buffer in samples, see GetBufferSize()
+    */
+    void Init(float sr, float *buffer, size_t size)
     {
         force_recalc_ = false;
         sr_           = sr;
+        rng_.Reset();
         mod_freq_     = 5.0f;
         SetSemitones();
         for(uint8_t i = 0; i < 2; i++)
         {
             gain_[i] = 0.0f;
-            d_[i].Init();
+            d_[i].Init(buffer + i * (size / 2), size / 2);
             phs_[i].Init(sr, 50, i == 0 ? 0 : PI_F);
         }
         shift_up_ = true;
-        del_size_ = SHIFT_BUFFER_SIZE;
+        del_size_ = d_[0].GetSize();
         SetDelSize(del_size_);
         fun_ = 0.0f;
     }
 
+    /** Returns the delay memory in samples that gives the same delay
+        window at sample_rate as the built-in memory does at 48kHz.
+    */
+    static size_t GetBufferSize(float sample_rate)
+    {
+        return 2
+               * get_next_power2(
+                   (uint32_t)(SHIFT_BUFFER_SIZE * sample_rate / 48000.f + .5f));
+    }
+
     /** process pitch shifter
     */
     float Process(float &in)
@@ -88,17 +94,19 @@ class PitchShifter
         fade2 = phs_[1].Process();
         if(prev_phs_a_ > fade1)
         {
-            mod_a_amt_ = fun_ * ((float)(myrand() % 255) / 255.0f)
+            mod_a_amt_ = fun_ * ((float)(rng_.NextUint() % 255) / 255.0f)
                          * (del_size_ * 0.5f);
-            mod_coeff_[0]
-                = 0.0002f + (((float)(myrand() % 255) / 255.0f) * 0.001f);
+            mod_coeff_[0] = 0.0002f
+                            + (((float)(rng_.NextUint() % 255) / 255.0f)
+                               * 0.001f);
         }
         if(prev_phs_b_ > fade2)
         {
-            mod_b_amt_ = fun_ * ((float)(myrand() % 255) / 255.0f)
+            mod_b_amt_ = fun_ * ((float)(rng_.NextUint() % 255) / 255.0f)
                          * (del_size_ * 0.5f);
-            mod_coeff_[1]
-                = 0.0002f + (((float)(myrand() % 255) / 255.0f) * 0.001f);
+            mod_coeff_[1] = 0.0002f
+                            + (((float)(rng_.NextUint() % 255) / 255.0f)
+                               * 0.001f);
         }
         slewed_mod_[0] += mod_coeff_[0] * (mod_a_amt_ - slewed_mod_[0]);
         slewed_mod_[1] += mod_coeff_[1] * (mod_b_amt_ - slewed_mod_[1]);
@@ -134,6 +142,20 @@ class PitchShifter
         return val;
     }
 
+    /** process a block of samples through the pitch shifter
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size)
+    {
+        for(size_t i = 0; i < size; i++)
+        {
+            float x = in[i];
+            out[i]  = Process(x);
+        }
+    }
+
     /** sets transposition in semitones
     */
     void SetTransposition(const float &transpose)
@@ -172,7 +194,7 @@ class PitchShifter
     */
     void SetDelSize(uint32_t size)
     {
-        del_size_     = size < SHIFT_BUFFER_SIZE ? size : SHIFT_BUFFER_SIZE;
+        del_size_     = size < d_[0].GetSize() ? size : d_[0].GetSize();
         force_recalc_ = true;
         SetTransposition(transpose_);
     }
@@ -181,6 +203,9 @@ class PitchShifter
     */
     inline void SetFun(float f) { fun_ = f; }
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
     inline void SetSemitones()
     {
@@ -189,10 +214,11 @@ class PitchShifter
             semitone_ratios_[i] = powf(2.0f, (float)i / 12);
         }
     }
-    typedef DelayLine<float, SHIFT_BUFFER_SIZE> ShiftDelay;
-    ShiftDelay                                  d_[2];
-    float                                       pitch_shift_, mod_freq_;
-    uint32_t                                    del_size_;
+    typedef DelayLine<float, DELAYLINE_USER_MEMORY, true> ShiftDelay;
+
+    ShiftDelay d_[2];
+    float      pitch_shift_, mod_freq_;
+    uint32_t   del_size_;
     /** lfo stuff
 */
     bool   force_recalc_;
@@ -204,7 +230,11 @@ class PitchShifter
     float  slewed_mod_[2], mod_coeff_[2];
     /** pitch stuff
 */
-    float semitone_ratios_[12];
+    float  semitone_ratios_[12];
+    Random rng_;
+#if !defined(DSY_DELAY_USER_MEMORY)
+    float buffer_[2][SHIFT_BUFFER_SIZE];
+#endif
 };
 } // namespace daisysp
 
@@ -3,6 +3,7 @@
 #include <stdint.h>
 #include <string.h>
 #include "reverbsc.h"
+#include "Utility/simd.h"
 
 #define REVSC_OK 0
 #define REVSC_NOT_OK 1
@@ -38,11 +39,20 @@ static const float kReverbParams[8][4]
 
 static int DelayLineMaxSamples(float sr, float i_pitch_mod, int n);
 //static int InitDelayLine(dsy_reverbsc_dl *lp, int n);
-static int         DelayLineBytesAlloc(float sr, float i_pitch_mod, int n);
 static const float kOutputGain = 0.35;
 static const float kJpScale    = 0.25;
 
+/* Frames per pass of ReverbSc::ProcessBlock() */
+static const size_t kBlockChunk = 48;
+
+#if !defined(DSY_DELAY_USER_MEMORY)
 int ReverbSc::Init(float sr)
+{
+    return Init(sr, aux_, DSY_REVERBSC_MAX_SIZE);
+}
+#endif
+
+int ReverbSc::Init(float sr, float *buffer, size_t size)
 {
     i_sample_rate_ = sr;
     sample_rate_   = sr;
@@ -53,17 +63,27 @@ int ReverbSc::Init(float sr)
     damp_fact_     = 1.0;
     prv_lpfreq_    = 0.0;
     init_done_     = 1;
-    int i, n_bytes = 0;
-    n_bytes = 0;
-    for(i = 0; i < 8; i++)
+    size_t offset  = 0;
+    for(int i = 0; i < 8; i++)
     {
-        if(n_bytes > DSY_REVERBSC_MAX_SIZE)
-            return 1;
-        delay_lines_[i].buf = (aux_) + n_bytes;
+        size_t n_samples = DelayLineMaxSamples(sr, 1, i);
+        if(offset + n_samples > size)
+            return REVSC_NOT_OK;
+        delay_lines_[i].buf = buffer + offset;
         InitDelayLine(&delay_lines_[i], i);
-        n_bytes += DelayLineBytesAlloc(sr, 1, i);
+        offset += n_samples;
+    }
+    return REVSC_OK;
+}
+
+size_t ReverbSc::GetBufferSize(float sr)
+{
+    size_t size = 0;
+    for(int i = 0; i < 8; i++)
+    {
+        size += DelayLineMaxSamples(sr, 1, i);
     }
-    return 0;
+    return size;
 }
 
 static int DelayLineMaxSamples(float sr, float i_pitch_mod, int n)
@@ -75,14 +95,6 @@ static int DelayLineMaxSamples(float sr, float i_pitch_mod, int n)
     return (int)(max_del * sr + 16.5);
 }
 
-static int DelayLineBytesAlloc(float sr, float i_pitch_mod, int n)
-{
-    int n_bytes = 0;
-
-    n_bytes += (DelayLineMaxSamples(sr, i_pitch_mod, n) * (int)sizeof(float));
-    return n_bytes;
-}
-
 void ReverbSc::NextRandomLineseg(ReverbScDl *lp, int n)
 {
     float prv_del, nxt_del, phs_inc_val;
@@ -150,21 +162,14 @@ int ReverbSc::Process(const float &in1,
     int         read_pos;
     uint32_t    n;
     int         buffer_size; /* Local copy */
-    float       damp_fact = damp_fact_;
+    float       damp_fact;
 
     //if (init_done_ <= 0) return REVSC_NOT_OK;
     if(init_done_ <= 0)
         return REVSC_NOT_OK;
 
-    /* calculate tone filter coefficient if frequency changed */
-    if(lpfreq_ != prv_lpfreq_)
-    {
-        prv_lpfreq_ = lpfreq_;
-        damp_fact
-            = 2.0f - cosf(prv_lpfreq_ * (2.0f * (float)M_PI) / sample_rate_);
-        damp_fact = damp_fact_
-            = damp_fact - sqrtf(damp_fact * damp_fact - 1.0f);
-    }
+    UpdateDampFact();
+    damp_fact = damp_fact_;
 
     /* calculate "resultant junction pressure" and mix to input signals */
 
@@ -281,3 +286,271 @@ int ReverbSc::Process(const float &in1,
     *out2 = a_out_r * kOutputGain;
     return REVSC_OK;
 }
+
+int ReverbSc::ProcessBlock(const float *in1,
+                           const float *in2,
+                           float *      out1,
+                           float *      out2,
+                           size_t       size)
+{
+    /* vectors run along time, one delay line at a time */
+    typedef simd::FloatVec<simd::kNativeWidth> Vec;
+    const size_t                               kWidth = simd::kNativeWidth;
+    static const float kRamp[8] = {0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f};
+
+    /* per delay line and frame: feedback signal read from the line (later
+       reused for the signal sent to it), and the filter state before each
+       frame */
+    float y[8][kBlockChunk], state[8][kBlockChunk + 1];
+    float filter_state[8], in_l[kBlockChunk], in_r[kBlockChunk];
+    float out_l[kBlockChunk], out_r[kBlockChunk];
+
+    if(init_done_ <= 0)
+        return REVSC_NOT_OK;
+
+    UpdateDampFact();
+    /* the lowpass filter below is state * damp_fact + y, so its input
+       gain of 1 - damp_fact goes with the feedback gain */
+    const float damp_fact = damp_fact_;
+    const float gain      = feedback_ * (1.f - damp_fact);
+
+    while(size > 0)
+    {
+        /* Every line is read for the whole chunk before anything is
+           written to it, so the chunk must be shorter than the shortest
+           delay. It also ends where the next random line segment starts. */
+        size_t todo = size < kBlockChunk ? size : kBlockChunk;
+        for(int n = 0; n < 8; n++)
+        {
+            const ReverbScDl &lp    = delay_lines_[n];
+            int               delay = lp.write_pos - lp.read_pos;
+            delay += delay < 0 ? lp.buffer_size : 0;
+            const size_t cnt  = lp.rand_line_cnt;
+            const size_t room = delay > 4 ? delay - 4 : 0;
+            todo              = cnt < todo ? cnt : todo;
+            todo              = room < todo ? room : todo;
+        }
+        /* too short to pay for the setup, or no room at all */
+        if(todo < 8)
+        {
+            Process(*in1++, *in2++, out1++, out2++);
+            size--;
+            continue;
+        }
+
+        /* vector loops run over whole vectors, the padding is discarded */
+        const size_t padded = (todo + kWidth - 1) / kWidth * kWidth;
+        for(size_t i = 0; i < padded; i++)
+        {
+            in_l[i] = i < todo ? in1[i] : 0.f;
+            in_r[i] = i < todo ? in2[i] : 0.f;
+        }
+
+        /* read from the delay lines with cubic interpolation */
+        for(int n = 0; n < 8; n++)
+        {
+            ReverbScDl * lp    = &delay_lines_[n];
+            const float *line  = lp->buf;
+            const int    bsize = lp->buffer_size;
+            const int    inc   = lp->read_pos_frac_inc;
+            if(lp->read_pos_frac >= DELAYPOS_SCALE)
+            {
+                lp->read_pos += (lp->read_pos_frac >> DELAYPOS_SHIFT);
+                lp->read_pos_frac &= DELAYPOS_MASK;
+            }
+            if(lp->read_pos >= bsize)
+                lp->read_pos -= bsize;
+            const int pos  = lp->read_pos;
+            const int frac = lp->read_pos_frac;
+
+            /* Usually the read position moves exactly one sample per frame
+               throughout the chunk and stays clear of the buffer end, so the
+               four taps are plain vector loads. */
+            const int64_t drift = (int64_t)(inc - DELAYPOS_SCALE);
+            const int64_t last  = frac + drift * (int64_t)(todo - 1);
+            if(pos > 0 && pos + (int)padded + 1 < bsize && last >= 0
+               && last < DELAYPOS_SCALE)
+            {
+                const float *taps = line + pos;
+                const Vec    frac0((float)frac * (1.f / DELAYPOS_SCALE));
+                const Vec    dfrac((float)drift * (1.f / DELAYPOS_SCALE));
+                const Vec    ramp = Vec::Load(kRamp);
+                for(size_t i = 0; i < padded; i += kWidth)
+                {
+                    const Vec f   = frac0 + (ramp + Vec((float)i)) * dfrac;
+                    const Vec x0  = Vec::Load(taps + i);
+                    const Vec a2  = (f * f - Vec(1.f)) * Vec(1.f / 6.f);
+                    const Vec a1  = (f + Vec(1.f)) * Vec(.5f);
+                    const Vec am1 = a1 - Vec(1.f) - a2;
+                    const Vec a0  = Vec(3.f) * a2;
+                    const Vec v   = am1 * Vec::Load(taps + i - 1)
+                                  + (a0 - f) * x0
+                                  + (a1 - a0) * Vec::Load(taps + i + 1)
+                                  + a2 * Vec::Load(taps + i + 2);
+                    ((v * f + x0) * Vec(gain)).Store(&y[n][i]);
+                }
+                lp->read_pos      = pos + (int)todo - 1;
+                lp->read_pos_frac = (int)last + inc;
+            }
+            else
+            {
+                for(size_t i = 0; i < padded; i++)
+                {
+                    y[n][i] = i < todo ? ReadDelayLine(lp) * gain : 0.f;
+                }
+            }
+        }
+
+        /* lowpass filter, with the lines side by side in two groups of
+           four, transposed from and to vectors along time */
+        typedef simd::FloatVec<4> Vec4;
+        for(int n = 0; n < 8; n++)
+        {
+            state[n][0] = filter_state[n] = delay_lines_[n].filter_state;
+        }
+        const Vec4 damp(damp_fact);
+        Vec4       lo = Vec4::Load(filter_state);
+        Vec4       hi = Vec4::Load(filter_state + 4);
+        for(size_t i = 0; i < padded; i += 4)
+        {
+            Vec4 lo0 = Vec4::Load(&y[0][i]), hi0 = Vec4::Load(&y[4][i]);
+            Vec4 lo1 = Vec4::Load(&y[1][i]), hi1 = Vec4::Load(&y[5][i]);
+            Vec4 lo2 = Vec4::Load(&y[2][i]), hi2 = Vec4::Load(&y[6][i]);
+            Vec4 lo3 = Vec4::Load(&y[3][i]), hi3 = Vec4::Load(&y[7][i]);
+            Transpose(lo0, lo1, lo2, lo3);
+            Transpose(hi0, hi1, hi2, hi3);
+            lo0 = lo = lo * damp + lo0;
+            hi0 = hi = hi * damp + hi0;
+            lo1 = lo = lo * damp + lo1;
+            hi1 = hi = hi * damp + hi1;
+            lo2 = lo = lo * damp + lo2;
+            hi2 = hi = hi * damp + hi2;
+            lo3 = lo = lo * damp + lo3;
+            hi3 = hi = hi * damp + hi3;
+            Transpose(lo0, lo1, lo2, lo3);
+            Transpose(hi0, hi1, hi2, hi3);
+            lo0.Store(&state[0][i + 1]);
+            lo1.Store(&state[1][i + 1]);
+            lo2.Store(&state[2][i + 1]);
+            lo3.Store(&state[3][i + 1]);
+            hi0.Store(&state[4][i + 1]);
+            hi1.Store(&state[5][i + 1]);
+            hi2.Store(&state[6][i + 1]);
+            hi3.Store(&state[7][i + 1]);
+        }
+
+        /* mix to output, and calculate "resultant junction pressure" and
+           mix to input signals */
+        for(size_t i = 0; i < padded; i += kWidth)
+        {
+            Vec a_in(0.f), a_out_l(0.f), a_out_r(0.f);
+            for(int n = 0; n < 8; n++)
+            {
+                a_in = a_in + Vec::Load(&state[n][i]);
+            }
+            for(int n = 0; n < 8; n += 2)
+            {
+                a_out_l = a_out_l + Vec::Load(&state[n][i + 1]);
+                a_out_r = a_out_r + Vec::Load(&state[n + 1][i + 1]);
+            }
+            (a_out_l * Vec(kOutputGain)).Store(&out_l[i]);
+            (a_out_r * Vec(kOutputGain)).Store(&out_r[i]);
+
+            a_in             = a_in * Vec(kJpScale);
+            const Vec a_in_l = a_in + Vec::Load(&in_l[i]);
+            const Vec a_in_r = a_in + Vec::Load(&in_r[i]);
+            for(int n = 0; n < 8; n += 2)
+            {
+                (a_in_l - Vec::Load(&state[n][i])).Store(&y[n][i]);
+                (a_in_r - Vec::Load(&state[n + 1][i])).Store(&y[n + 1][i]);
+            }
+        }
+        for(size_t i = 0; i < todo; i++)
+        {
+            out1[i] = out_l[i];
+            out2[i] = out_r[i];
+        }
+
+        /* send input signal and feedback to delay lines */
+        for(int n = 0; n < 8; n++)
+        {
+            ReverbScDl *lp    = &delay_lines_[n];
+            float *     line  = lp->buf;
+            const int   bsize = lp->buffer_size;
+            int         pos   = lp->write_pos;
+            if(pos + (int)todo < bsize)
+            {
+                memcpy(line + pos, y[n], todo * sizeof(float));
+                pos += (int)todo;
+            }
+            else
+            {
+                for(size_t i = 0; i < todo; i++)
+                {
+                    line[pos] = y[n][i];
+                    pos       = pos + 1 < bsize ? pos + 1 : 0;
+                }
+            }
+            lp->write_pos    = pos;
+            lp->filter_state = state[n][todo];
+
+            /* start next random line segment if current one has reached
+               endpoint */
+            lp->rand_line_cnt -= (int)todo;
+            if(lp->rand_line_cnt <= 0)
+                NextRandomLineseg(lp, n);
+        }
+
+        in1 += todo;
+        in2 += todo;
+        out1 += todo;
+        out2 += todo;
+        size -= todo;
+    }
+    return REVSC_OK;
+}
+
+float ReverbSc::ReadDelayLine(ReverbScDl *lp)
+{
+    const int bsize = lp->buffer_size;
+    if(lp->read_pos_frac >= DELAYPOS_SCALE)
+    {
+        lp->read_pos += (lp->read_pos_frac >> DELAYPOS_SHIFT);
+        lp->read_pos_frac &= DELAYPOS_MASK;
+    }
+    if(lp->read_pos >= bsize)
+        lp->read_pos -= bsize;
+    int         pos  = lp->read_pos;
+    const float frac = (float)lp->read_pos_frac * (1.f / DELAYPOS_SCALE);
+    lp->read_pos_frac += lp->read_pos_frac_inc;
+
+    /* read four samples, checking the index at buffer wrap-around */
+    const float *line = lp->buf;
+    const int    pm1  = pos > 0 ? pos - 1 : bsize - 1;
+    const int    p1   = pos + 1 < bsize ? pos + 1 : 0;
+    const int    p2   = p1 + 1 < bsize ? p1 + 1 : 0;
+    const float  vm1  = line[pm1];
+    const float  v0   = line[pos];
+    const float  v1   = line[p1];
+    const float  v2   = line[p2];
+
+    /* same interpolation coefficients as Process() */
+    const float a2  = (frac * frac - 1.f) * (1.f / 6.f);
+    const float a1  = (frac + 1.f) * .5f;
+    const float am1 = a1 - 1.f - a2;
+    const float a0  = 3.f * a2;
+    return (am1 * vm1 + (a0 - frac) * v0 + (a1 - a0) * v1 + a2 * v2) * frac
+           + v0;
+}
+
+void ReverbSc::UpdateDampFact()
+{
+    /* calculate tone filter coefficient if frequency changed */
+    if(lpfreq_ != prv_lpfreq_)
+    {
+        prv_lpfreq_ = lpfreq_;
+        float damp_fact
+            = 2.0f - cosf(prv_lpfreq_ * (2.0f * (float)M_PI) / sample_rate_);
+        damp_fact_ = damp_fact - sqrtf(damp_fact * damp_fact - 1.0f);
+    }
+}
@@ -2,6 +2,8 @@
 #ifndef DSYSP_REVERBSC_H
 #define DSYSP_REVERBSC_H
 
+#include <stddef.h>
+
 #define DSY_REVERBSC_MAX_SIZE 98936
 
 namespace daisysp
@@ -39,15 +41,45 @@ class ReverbSc
   public:
     ReverbSc() {}
     ~ReverbSc() {}
+#if !defined(DSY_DELAY_USER_MEMORY)
     /** Initializes the reverb module, and sets the sample_rate at which the Process function will be called.
+        The built-in memory of DSY_REVERBSC_MAX_SIZE samples covers sample rates up to 192kHz.
         Returns 0 if all good, or 1 if it runs out of delay times exceed maximum allowed.
     */
     int Init(float sample_rate);
+#endif
+
+    /** Initializes the reverb module with user-provided delay memory.
+        \param sample_rate - rate at which the Process function will be called
+        \param buffer - delay memory, must outlive the reverb
+        \param size - length of buffer in samples, see GetBufferSize()
+        Returns 0 if all good, or 1 if the buffer is too small for sample_rate.
+    */
+    int Init(float sample_rate, float *buffer, size_t size);
+
+    /** Returns the delay memory in samples needed at sample_rate.
+    */
+    static size_t GetBufferSize(float sample_rate);
 
     /** Process the input through the reverb, and updates values of out1, and out2 with the new processed signal.
     */
     int Process(const float &in1, const float &in2, float *out1, float *out2);
 
+    /** Processes a block of stereo samples. Same as calling Process() for
+        each frame, with the eight delay lines computed side by side in
+        SIMD lanes.
+        \param in1 - left input buffer, may be the same as out1
+        \param in2 - right input buffer, may be the same as out2
+        \param out1 - left output buffer
+        \param out2 - right output buffer
+        \param size - number of frames to process
+    */
+    int ProcessBlock(const float *in1,
+                     const float *in2,
+                     float *      out1,
+                     float *      out2,
+                     size_t       size);
+
     /** controls the reverb time. reverb tail becomes infinite when set to 1.0
         \param fb - sets reverb time. range: 0.0 to 1.0
     */
@@ -60,6 +92,8 @@ class ReverbSc
   private:
     void       NextRandomLineseg(ReverbScDl *lp, int n);
     int        InitDelayLine(ReverbScDl *lp, int n);
+    void       UpdateDampFact();
+    float      ReadDelayLine(ReverbScDl *lp);
     float      feedback_, lpfreq_;
     float      i_sample_rate_, i_pitch_mod_, i_skip_init_;
     float      sample_rate_;
@@ -67,7 +101,9 @@ class ReverbSc
     float      prv_lpfreq_;
     int        init_done_;
     ReverbScDl delay_lines_[8];
-    float      aux_[DSY_REVERBSC_MAX_SIZE];
+#if !defined(DSY_DELAY_USER_MEMORY)
+    float aux_[DSY_REVERBSC_MAX_SIZE];
+#endif
 };
 
 
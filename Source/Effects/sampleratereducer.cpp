@@ -41,3 +41,38 @@ void SampleRateReducer::SetFreq(float frequency)
 {
     frequency_ = fclamp(frequency, 0.f, 1.f);
 }
+
+void SampleRateReducer::ProcessBlock(const float *in, float *out, size_t size)
+{
+    const float frequency = frequency_;
+    float       phase     = phase_;
+    float       sample    = sample_;
+    float       previous  = previous_sample_;
+    float       next      = next_sample_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        const float x           = in[i];
+        float       this_sample = next;
+        next                    = 0.f;
+        phase += frequency;
+        if(phase >= 1.0f)
+        {
+            phase -= 1.0f;
+            float t             = phase / frequency;
+            float new_sample    = previous + (x - previous) * (1.0f - t);
+            float discontinuity = new_sample - sample;
+            this_sample += discontinuity * ThisBlepSample(t);
+            next   = discontinuity * NextBlepSample(t);
+            sample = new_sample;
+        }
+        next += sample;
+        previous = x;
+        out[i]   = this_sample;
+    }
+
+    phase_           = phase;
+    sample_          = sample;
+    previous_sample_ = previous;
+    next_sample_     = next;
+}
@@ -3,6 +3,7 @@
 #define DSY_SR_REDUCER_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 /** @file sampleratereducer.h */
@@ -31,6 +32,13 @@ class SampleRateReducer
     */
     float Process(float in);
 
+    /** Processes a block of samples.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
     /** Set the new sample rate.
         \param Works over 0-1. 1 is full quality, .5 is half sample rate, etc.
     */
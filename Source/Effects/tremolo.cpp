@@ -18,6 +18,22 @@ float Tremolo::Process(float in)
     return in * modsig;
 }
 
+void Tremolo::ProcessBlock(const float *in, float *out, size_t size)
+{
+    const float dc_os = dc_os_;
+
+    float mod[kChunkSize];
+    for(size_t start = 0; start < size; start += kChunkSize)
+    {
+        const size_t n = DSY_MIN(kChunkSize, size - start);
+        osc_.Render(mod, n);
+        for(size_t i = 0; i < n; i++)
+        {
+            out[start + i] = in[start + i] * (dc_os + mod[i]);
+        }
+    }
+}
+
 void Tremolo::SetFreq(float freq)
 {
     osc_.SetFreq(freq);
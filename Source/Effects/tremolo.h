@@ -3,6 +3,7 @@
 #define DSY_TREMOLO_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 #include <math.h>
@@ -35,6 +36,13 @@ class Tremolo
     */
     float Process(float in);
 
+    /** Processes a block of samples.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
     /** Sets the tremolo rate.
        \param freq Tremolo freq in Hz.
     */
@@ -52,6 +60,8 @@ class Tremolo
 
 
   private:
+    static constexpr size_t kChunkSize = 32;
+
     float      sample_rate_, dc_os_;
     Oscillator osc_;
 };
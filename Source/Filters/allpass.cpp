@@ -1,5 +1,6 @@
 #include "allpass.h"
 #include <math.h>
+#include "dsp.h"
 
 using namespace daisysp;
 
@@ -16,14 +17,19 @@ void Allpass::Init(float sample_rate, float* buff, size_t size)
     buf_pos_       = 0;
 }
 
-float Allpass::Process(float in)
+void Allpass::UpdateCoef()
 {
-    float y, z, out;
     if(prvt_ != rev_time_)
     {
         prvt_ = rev_time_;
-        coef_ = expf(-6.9078 * loop_time_ / prvt_);
+        coef_ = LutExp(-6.9078 * loop_time_ / prvt_);
     }
+}
+
+float Allpass::Process(float in)
+{
+    float y, z, out;
+    UpdateCoef();
 
     y              = buf_[buf_pos_];
     z              = coef_ * y + in;
@@ -35,6 +41,33 @@ float Allpass::Process(float in)
     return out;
 }
 
+void Allpass::ProcessBlock(const float* in, float* out, size_t size)
+{
+    UpdateCoef();
+
+    const float coef = coef_;
+    const int   mod  = mod_;
+    float*      buf  = buf_;
+    int         pos  = buf_pos_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        const float y = buf[pos];
+        const float z = coef * y + in[i];
+        buf[pos]      = z;
+        out[i]        = y - coef * z;
+
+        /* only pay for the modulo when wrapping around */
+        pos++;
+        if(pos >= mod)
+        {
+            pos %= mod;
+        }
+    }
+
+    buf_pos_ = pos;
+}
+
 void Allpass::SetFreq(float freq)
 {
     loop_time_ = fmaxf(fminf(freq, max_loop_time_), .0001);
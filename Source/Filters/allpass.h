@@ -38,6 +38,13 @@ class Allpass
     */
     float Process(float in);
 
+    /** Processes a block of samples.
+     \param in Input buffer, may be the same as out.
+     \param out Output buffer.
+     \param size Number of samples to process.
+    */
+    void ProcessBlock(const float* in, float* out, size_t size);
+
     /**
        Sets the filter frequency (Implemented by delay time).
        \param looptime Filter looptime in seconds.
@@ -51,6 +58,7 @@ class Allpass
 
 
   private:
+    void   UpdateCoef();
     float  sample_rate_, rev_time_, loop_time_, prvt_, coef_, max_loop_time_;
     float* buf_;
     int    buf_pos_, mod_;
@@ -22,11 +22,48 @@ float ATone::Process(float &in)
     return out;
 }
 
+void ATone::ProcessBlock(const float *in, float *out, size_t size)
+{
+    const float c2      = c2_;
+    float       prevout = prevout_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        const float x = in[i];
+        const float y = c2 * (prevout + x);
+        prevout       = y - x;
+        out[i]        = y;
+    }
+
+    prevout_ = prevout;
+}
+
+void ATone::ProcessBlock(const float *in, float *out, size_t size, float freq)
+{
+    if(size == 0)
+        return;
+    float c2 = c2_;
+    SetFreq(freq);
+    const float c2_inc  = (c2_ - c2) / static_cast<float>(size);
+    float       prevout = prevout_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        c2 += c2_inc;
+        const float x = in[i];
+        const float y = c2 * (prevout + x);
+        prevout       = y - x;
+        out[i]        = y;
+    }
+
+    prevout_ = prevout;
+}
+
 void ATone::CalculateCoefficients()
 {
     float b, c2;
 
-    b   = 2.0f - cosf(TWOPI_F * freq_ / sample_rate_);
+    b   = 2.0f - LutCos(freq_ / sample_rate_);
     c2  = b - sqrtf(b * b - 1.0f);
     c2_ = c2;
 }
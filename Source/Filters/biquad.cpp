@@ -6,27 +6,28 @@ using namespace daisysp;
 
 void Biquad::Reset()
 {
-    float con   = cutoff_ * two_pi_d_sr_;
-    float alpha = 1.0f - 2.0f * res_ * cosf(con) * cosf(con)
-                  + res_ * res_ * cosf(2 * con);
-    float beta  = 1.0f + cosf(con);
-    float gamma = 1 + cosf(con);
-    float m1    = alpha * gamma + beta * sinf(con);
-    float m2    = alpha * gamma - beta * sinf(con);
+    float sin_con, cos_con;
+    LutSinCos(cutoff_ / sample_rate_, &sin_con, &cos_con);
+    // cos(2 * con) = 2 * cos(con)^2 - 1
+    float alpha = 1.0f - 2.0f * res_ * cos_con * cos_con
+                  + res_ * res_ * (2.0f * cos_con * cos_con - 1.0f);
+    float beta  = 1.0f + cos_con;
+    float gamma = 1 + cos_con;
+    float m1    = alpha * gamma + beta * sin_con;
+    float m2    = alpha * gamma - beta * sin_con;
     float den   = sqrtf(m1 * m1 + m2 * m2);
 
     b0_ = 1.5f * (alpha * alpha + beta * beta) / den;
     b1_ = b0_;
     b2_ = 0.0f;
     a0_ = 1.0f;
-    a1_ = -2.0 * res_ * cosf(con);
+    a1_ = -2.0 * res_ * cos_con;
     a2_ = res_ * res_;
 }
 
 void Biquad::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
-    two_pi_d_sr_ = TWOPI_F / sample_rate_;
 
     cutoff_ = 500;
     res_    = 0.7;
@@ -57,3 +58,28 @@ float Biquad::Process(float in)
 
     return yn;
 }
+
+void Biquad::ProcessBlock(const float *in, float *out, size_t size)
+{
+    const float a0_recip = 1.0f / a0_;
+    const float a1 = a1_ * a0_recip, a2 = a2_ * a0_recip;
+    const float b0 = b0_ * a0_recip, b1 = b1_ * a0_recip, b2 = b2_ * a0_recip;
+    float       xnm1 = xnm1_, xnm2 = xnm2_, ynm1 = ynm1_, ynm2 = ynm2_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        const float xn = in[i];
+        const float yn = b0 * xn + b1 * xnm1 + b2 * xnm2 - a1 * ynm1 - a2 * ynm2;
+
+        xnm2   = xnm1;
+        xnm1   = xn;
+        ynm2   = ynm1;
+        ynm1   = yn;
+        out[i] = yn;
+    }
+
+    xnm1_ = xnm1;
+    xnm2_ = xnm2;
+    ynm1_ = ynm1;
+    ynm2_ = ynm2;
+}
@@ -3,6 +3,7 @@
 #define DSY_BIQUAD_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -31,6 +32,13 @@ class Biquad
     */
     float Process(float in);
 
+    /** Filters a block of samples
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
 
     /** Sets resonance amount
         \param res : Set filter resonance.
@@ -52,8 +60,8 @@ class Biquad
     }
 
   private:
-    float sample_rate_, cutoff_, res_, b0_, b1_, b2_, a0_, a1_, a2_,
-        two_pi_d_sr_, xnm1_, xnm2_, ynm1_, ynm2_;
+    float sample_rate_, cutoff_, res_, b0_, b1_, b2_, a0_, a1_, a2_, xnm1_,
+        xnm2_, ynm1_, ynm2_;
     void Reset();
 };
 } // namespace daisysp
@@ -1,5 +1,6 @@
 #include "comb.h"
 #include <math.h>
+#include "dsp.h"
 
 using namespace daisysp;
 
@@ -19,35 +20,68 @@ void Comb::Init(float sample_rate, float* buff, size_t size)
     buf_pos_       = 0;
 }
 
-float Comb::Process(float in)
+void Comb::UpdateCoef()
 {
-    float tmp     = 0;
-    float coef    = coef_;
-    float outsamp = 0;
-
     if(prvt_ != rev_time_)
     {
         prvt_         = rev_time_;
         float exp_arg = (float)(log001 * loop_time_ / prvt_);
         if(exp_arg < -36.8413615)
         {
-            coef = coef_ = 0;
+            coef_ = 0;
         }
         else
         {
-            coef = coef_ = expf(exp_arg);
+            coef_ = LutExp(exp_arg);
         }
     }
+}
+
+float Comb::Process(float in)
+{
+    float tmp     = 0;
+    float outsamp = 0;
+
+    UpdateCoef();
 
     // internal delay line
     outsamp                = buf_[(buf_pos_ + mod_) % max_size_];
-    tmp                    = (outsamp * coef) + in;
+    tmp                    = (outsamp * coef_) + in;
     buf_[(size_t)buf_pos_] = tmp;
     buf_pos_               = (buf_pos_ - 1 + max_size_) % max_size_;
 
     return outsamp;
 }
 
+void Comb::ProcessBlock(const float* in, float* out, size_t size)
+{
+    UpdateCoef();
+
+    const float  coef     = coef_;
+    const size_t mod      = mod_;
+    const size_t max_size = max_size_;
+    float*       buf      = buf_;
+    size_t       pos      = buf_pos_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        /* mod_ never exceeds max_size_, so one conditional wrap is enough */
+        size_t read = pos + mod;
+        if(read >= max_size)
+        {
+            read -= max_size;
+        }
+
+        const float outsamp = buf[read];
+        buf[pos]            = (outsamp * coef) + in[i];
+        out[i]              = outsamp;
+
+        pos = pos == 0 ? max_size - 1 : pos - 1;
+    }
+
+    buf_pos_ = pos;
+}
+
 void Comb::SetPeriod(float looptime)
 {
     if(looptime > 0)
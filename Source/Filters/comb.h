@@ -31,6 +31,13 @@ class Comb
     */
     float Process(float in);
 
+    /** processes a block of samples through the comb filter
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float* in, float* out, size_t size);
+
 
     /** Sets the period of the comb filter in seconds
     */
@@ -51,6 +58,7 @@ class Comb
     inline void SetRevTime(float revtime) { rev_time_ = revtime; }
 
   private:
+    void   UpdateCoef();
     float  sample_rate_, rev_time_, loop_time_, prvt_, coef_, max_loop_time_;
     float* buf_;
     size_t buf_pos_, mod_, max_size_;
@@ -0,0 +1,216 @@
+#pragma once
+#ifndef DSY_FASTCONV_H
+#define DSY_FASTCONV_H
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+#include <utility>
+#include "Utility/dsp.h"
+#include "Utility/fft.h"
+#include "Filters/fir.h"
+
+/**   @brief Partitioned FFT convolution with zero latency
+ *
+ *    The impulse response is split into a head of partition_size taps, run
+ *    through the direct form FIRFilterImplCircular, and a tail of uniform
+ *    partitions of partition_size taps, run through an overlap-save FFT
+ *    convolution with a frequency domain delay line. The tail of the next
+ *    partition_size output samples is computed every time partition_size
+ *    input samples have been collected, so the convolver introduces no
+ *    latency and accepts any block size.
+ *
+ *    Cost per sample is roughly partition_size multiply-adds for the head
+ *    plus 4 * max_size / partition_size for the tail and two FFTs of
+ *    2 * partition_size points per partition, instead of max_size
+ *    multiply-adds for the direct FIR. The FFT work is done in one burst per
+ *    partition, so the worst-case block time grows with partition_size.
+ */
+
+namespace daisysp
+{
+/** FFT convolver with the SetIR/Process/ProcessBlock interface of FIR
+ * \param max_size - maximal impulse response length
+ * \param partition_size - head length and tail partition size, power of 2
+ */
+template <size_t max_size, size_t partition_size = 64>
+class FastConv
+{
+  public:
+    /* Default constructor */
+    FastConv() {}
+
+    /* Reset filter state (but not the impulse response) */
+    void Reset()
+    {
+        head_.Reset();
+        memset(fdl_, 0, sizeof(fdl_));
+        memset(frame_, 0, sizeof(frame_));
+        memset(tail_out_, 0, sizeof(tail_out_));
+        frame_pos_ = 0;
+        fdl_pos_   = 0;
+    }
+
+    /* Latency is always 0, the head of the response is convolved directly */
+    static constexpr size_t GetLatency() { return 0; }
+
+    /* Process one sample at a time */
+    float Process(float in)
+    {
+        frame_[partition_size + frame_pos_] = in;
+        const float out = head_.Process(in) + tail_out_[frame_pos_];
+        if(++frame_pos_ == partition_size)
+        {
+            ProcessTail();
+        }
+        return out;
+    }
+
+    /* Process a block of data of any length, may run in place */
+    void ProcessBlock(const float* pSrc, float* pDst, size_t block)
+    {
+        assert(nullptr != pSrc);
+        assert(nullptr != pDst);
+
+        while(block > 0)
+        {
+            /* never cross a partition boundary */
+            const size_t chunk = DSY_MIN(block, partition_size - frame_pos_);
+
+            memcpy(frame_ + partition_size + frame_pos_,
+                   pSrc,
+                   chunk * sizeof(float));
+            head_.ProcessBlock(pSrc, pDst, chunk);
+            for(size_t i = 0; i < chunk; i++)
+            {
+                pDst[i] += tail_out_[frame_pos_ + i];
+            }
+
+            frame_pos_ += chunk;
+            if(frame_pos_ == partition_size)
+            {
+                ProcessTail();
+            }
+            pSrc += chunk;
+            pDst += chunk;
+            block -= chunk;
+        }
+    }
+
+    /** Set the impulse response
+     * Coefficients need to be in reversed order (tail-first) like for FIR,
+     * or in natural order with reverse set to true.
+     * Always makes a local copy (as frequency domain partitions).
+     */
+    bool SetIR(const float* ir, size_t len, bool reverse)
+    {
+        assert(nullptr != ir || 0 == len);
+
+        fft_.Init();
+
+        /* truncate silently, keeping the start of the response */
+        const size_t size = DSY_MIN(len, max_size);
+        /* natural order tap k of the (possibly truncated) response */
+        auto tap = [ir, len, reverse](size_t k) {
+            return reverse ? ir[k] : ir[len - 1u - k];
+        };
+
+        /* the head runs through the direct FIR, tail-first */
+        const size_t head = DSY_MIN(size, partition_size);
+        float        head_ir[partition_size];
+        for(size_t k = 0; k < head; k++)
+        {
+            head_ir[head - 1u - k] = tap(k);
+        }
+        const bool result = head_.SetIR(head_ir, head, false);
+
+        /* the tail is stored as spectra of zero padded partitions */
+        num_parts_ = (size - head + partition_size - 1u) / partition_size;
+        for(size_t p = 0; p < num_parts_; p++)
+        {
+            float*       part  = ir_parts_[p];
+            const size_t start = partition_size * (p + 1u);
+            for(size_t i = 0; i < partition_size; i++)
+            {
+                part[i] = start + i < size ? tap(start + i) : 0.0f;
+            }
+            memset(part + partition_size, 0, partition_size * sizeof(float));
+            fft_.Forward(part, part);
+        }
+
+        Reset();
+        return result;
+    }
+
+    /* Create an alias to comply with DaisySP API conventions */
+    template <typename... Args>
+    inline auto Init(Args&&... args)
+        -> decltype(SetIR(std::forward<Args>(args)...))
+    {
+        return SetIR(std::forward<Args>(args)...);
+    }
+
+  private:
+    static_assert(partition_size >= 2
+                      && (partition_size & (partition_size - 1)) == 0,
+                  "FastConv: partition_size must be a power of 2");
+
+    static constexpr size_t kFftSize = 2 * partition_size;
+    static constexpr size_t kMaxParts
+        = max_size > partition_size
+              ? (max_size - 1u) / partition_size /* ceil((max - P) / P) */
+              : 1u;
+
+    /* Called once a full partition of input has been collected */
+    void ProcessTail()
+    {
+        frame_pos_ = 0;
+        if(num_parts_ == 0)
+        {
+            return;
+        }
+
+        /* spectrum of the last two partitions of input */
+        fft_.Forward(frame_, fdl_[fdl_pos_]);
+        memcpy(frame_, frame_ + partition_size, partition_size * sizeof(float));
+
+        /* multiply-accumulate the delayed input spectra with the partitions */
+        memset(acc_, 0, sizeof(acc_));
+        size_t slot = fdl_pos_;
+        for(size_t p = 0; p < num_parts_; p++)
+        {
+            const float* x = fdl_[slot];
+            const float* h = ir_parts_[p];
+            acc_[0] += x[0] * h[0]; /* DC */
+            acc_[1] += x[1] * h[1]; /* Nyquist */
+            for(size_t k = 2; k < kFftSize; k += 2)
+            {
+                acc_[k] += x[k] * h[k] - x[k + 1] * h[k + 1];
+                acc_[k + 1] += x[k] * h[k + 1] + x[k + 1] * h[k];
+            }
+            slot = slot == 0 ? num_parts_ - 1u : slot - 1u;
+        }
+        fdl_pos_ = fdl_pos_ + 1u == num_parts_ ? 0 : fdl_pos_ + 1u;
+
+        /* overlap-save: the second half is the tail of the next partition */
+        fft_.Inverse(acc_, acc_);
+        memcpy(
+            tail_out_, acc_ + partition_size, partition_size * sizeof(float));
+    }
+
+    FIRFilterImplCircular<partition_size, partition_size> head_;
+    RealFft<kFftSize>                                     fft_;
+
+    float  ir_parts_[kMaxParts][kFftSize]; /*< tail partition spectra */
+    float  fdl_[kMaxParts][kFftSize];      /*< delayed input spectra */
+    float  frame_[kFftSize];               /*< last two input partitions */
+    float  acc_[kFftSize];                 /*< spectrum accumulator */
+    float  tail_out_[partition_size];      /*< tail output, next partition */
+    size_t num_parts_ = 0;
+    size_t frame_pos_ = 0;
+    size_t fdl_pos_   = 0;
+};
+
+} // namespace daisysp
+
+#endif // DSY_FASTCONV_H
@@ -6,6 +6,8 @@
 #include <cstring> // for memset
 #include <cassert>
 #include <utility>
+#include "Utility/dsp.h"
+#include "Utility/simd.h"
 
 #ifdef USE_ARM_DSP
 #include <arm_math.h> // required for platform-optimized version
@@ -255,6 +257,146 @@ class FIRFilterImplGeneric : public FIRMemory<max_size, max_block>
 };
 
 
+/** Generic FIR implementation with a mirrored circular state buffer
+ * \param max_size - maximal filter length
+ * \param max_block - maximal block size for ProcessBlock()
+ *
+ * Every input sample is written twice, L samples apart, into a state buffer
+ * of 2 * L samples (L being the filter length rounded up to the vector
+ * step). The last L inputs are thus always available as one contiguous
+ * window and no state is ever shifted or copied. The inner product runs on
+ * SIMD vectors (see Utility/simd.h) with four independent accumulators.
+ *
+ * Results differ from FIRFilterImplGeneric in the order of summation only.
+ * User-provided memory (FIRFILTER_USER_MEMORY) is not supported,
+ * the FIR alias falls back to FIRFilterImplGeneric for it.
+ */
+template <size_t max_size, size_t max_block>
+class FIRFilterImplCircular
+{
+  private:
+    using Vec = simd::FloatVec<simd::kNativeWidth>;
+
+    /* Samples per iteration of the inner product loop */
+    static constexpr size_t kStep = 4 * Vec::kWidth;
+    /* Filter length rounded up to the step */
+    static constexpr size_t kMaxLength = (max_size + kStep - 1u) / kStep * kStep;
+
+  public:
+    static_assert(max_size > 0 && max_block > 0,
+                  "FIRFilterImplCircular: user memory is not supported");
+
+    /* Default constructor */
+    FIRFilterImplCircular()
+    : state_{0}, coefs_{0}, size_(0), length_(kStep), pos_(0)
+    {
+    }
+
+    /* Reset filter state (but not the coefficients) */
+    void Reset()
+    {
+        memset(state_, 0, sizeof(state_));
+        pos_ = 0;
+    }
+
+    /* FIR Latency is always 0, but API is unified with FFT and FastConv */
+    static constexpr size_t GetLatency() { return 0; }
+
+    /* Process one sample at a time */
+    float Process(float in)
+    {
+        assert(size_ > 0u);
+        /* Feed data into both halves of the buffer */
+        state_[pos_]           = in;
+        state_[pos_ + length_] = in;
+        pos_                   = pos_ + 1u == length_ ? 0 : pos_ + 1u;
+
+        /* the window now starts with the oldest sample */
+        return Dot(state_ + pos_);
+    }
+
+    /* Process a block of data */
+    void ProcessBlock(const float* pSrc, float* pDst, size_t block)
+    {
+        /* be sure to run debug version from time to time */
+        assert(block <= max_block);
+        assert(nullptr != pSrc);
+        assert(nullptr != pDst);
+
+        for(size_t j = 0; j < block; j++)
+        {
+            pDst[j] = Process(pSrc[j]);
+        }
+    }
+
+    /** Set filter coefficients (aka Impulse Response)
+     * Coefficients need to be in reversed order (tail-first)
+     * Always makes a local copy and allows reversing the impulse response
+     */
+    bool SetIR(const float* ir, size_t len, bool reverse)
+    {
+        assert(nullptr != ir || 0 == len);
+
+        /* truncate silently */
+        size_   = DSY_MIN(len, max_size);
+        length_ = DSY_MAX((size_ + kStep - 1u) / kStep * kStep, kStep);
+
+        /* zero taps in front of the (tail-first) response pad it to L */
+        const size_t pad = length_ - size_;
+        memset(coefs_, 0, sizeof(coefs_));
+        for(size_t i = 0; i < size_; i++)
+        {
+            /* start from len, not size_! */
+            coefs_[pad + i] = reverse ? ir[len - 1u - i] : ir[i];
+        }
+
+        Reset();
+        return true;
+    }
+
+    /* Create an alias to comply with DaisySP API conventions */
+    template <typename... Args>
+    inline auto Init(Args&&... args)
+        -> decltype(SetIR(std::forward<Args>(args)...))
+    {
+        return SetIR(std::forward<Args>(args)...);
+    }
+
+  protected:
+    /* Inner product of length_ samples of x with the coefficients */
+    float Dot(const float* x) const
+    {
+        constexpr size_t w = Vec::kWidth;
+
+        Vec acc0(0.0f), acc1(0.0f), acc2(0.0f), acc3(0.0f);
+        for(size_t i = 0; i < length_; i += kStep)
+        {
+            const float* s = x + i;
+            const float* c = coefs_ + i;
+            acc0           = acc0 + Vec::Load(s) * Vec::Load(c);
+            acc1           = acc1 + Vec::Load(s + w) * Vec::Load(c + w);
+            acc2           = acc2 + Vec::Load(s + 2 * w) * Vec::Load(c + 2 * w);
+            acc3           = acc3 + Vec::Load(s + 3 * w) * Vec::Load(c + 3 * w);
+        }
+
+        float sum[w];
+        ((acc0 + acc1) + (acc2 + acc3)).Store(sum);
+        float acc = 0.0f;
+        for(size_t i = 0; i < w; i++)
+        {
+            acc += sum[i];
+        }
+        return acc;
+    }
+
+    float  state_[2 * kMaxLength]; /*< mirrored state */
+    float  coefs_[kMaxLength];     /*< padded with zeros */
+    size_t size_;   /*< Active filter length (<= max_size) */
+    size_t length_; /*< Padded filter length, multiple of kStep */
+    size_t pos_;    /*< Next write position, 0 to length_ - 1 */
+};
+
+
 #if(defined(USE_ARM_DSP) && defined(__arm__))
 
 /** ARM-specific FIR implementation, expose only on __arm__ platforms
@@ -329,12 +471,32 @@ template <size_t max_size, size_t max_block>
 using FIR = FIRFilterImplARM<max_size, max_block>;
 
 
-#else // USE_ARM_DSP
+#elif defined(DSY_FIR_GENERIC)
 
-/* default to generic implementation */
+/* generic implementation on request */
 template <size_t max_size, size_t max_block>
 using FIR = FIRFilterImplGeneric<max_size, max_block>;
 
+#else // USE_ARM_DSP
+
+/* Picks the circular implementation for internal memory only */
+template <size_t max_size, size_t max_block>
+struct FIRFilterImplDefault
+{
+    using type = FIRFilterImplCircular<max_size, max_block>;
+};
+
+template <>
+struct FIRFilterImplDefault<FIRFILTER_USER_MEMORY>
+{
+    using type = FIRFilterImplGeneric<FIRFILTER_USER_MEMORY>;
+};
+
+/* default to the circular buffer implementation,
+   define DSY_FIR_GENERIC to use FIRFilterImplGeneric instead */
+template <size_t max_size, size_t max_block>
+using FIR = typename FIRFilterImplDefault<max_size, max_block>::type;
+
 #endif // USE_ARM_DSP
 
 
@@ -44,46 +44,60 @@ void Mode::Clear()
     lq_             = -1.0f;
 }
 
-float Mode::Process(float in)
+void Mode::CalculateCoefficients()
 {
-    float out;
-    float lfq = lfq_, lq = lq_;
-    float xn, yn, a0 = a0_, a1 = a1_, a2 = a2_, d = d_;
-    float xnm1 = xnm1_, ynm1 = ynm1_, ynm2 = ynm2_;
-    float kfq = freq_;
-    float kq  = q_;
-
-    if(lfq != kfq || lq != kq)
+    if(lfq_ != freq_ || lq_ != q_)
     {
-        float kfreq  = kfq * (2.0f * (float)M_PI);
+        float kfreq  = freq_ * (2.0f * (float)M_PI);
         float kalpha = (sr_ / kfreq);
         float kbeta  = kalpha * kalpha;
-        d            = 0.5f * kalpha;
-        lq           = kq;
-        lfq          = kfq;
-        a0           = 1.0f / (kbeta + d / kfreq);
-        a1           = a0 * (1.0f - 2.0f * kbeta);
-        a2           = a0 * (kbeta - d / kq);
+        d_           = 0.5f * kalpha;
+        lq_          = q_;
+        lfq_         = freq_;
+        a0_          = 1.0f / (kbeta + d_ / kfreq);
+        a1_          = a0_ * (1.0f - 2.0f * kbeta);
+        a2_          = a0_ * (kbeta - d_ / q_);
     }
+}
+
+float Mode::Process(float in)
+{
+    float out;
+    float xn, yn;
+
+    CalculateCoefficients();
+
     xn = in;
+    yn = a0_ * xnm1_ - a1_ * ynm1_ - a2_ * ynm2_;
 
-    yn = a0 * xnm1 - a1 * ynm1 - a2 * ynm2;
+    xnm1_ = xn;
+    ynm2_ = ynm1_;
+    ynm1_ = yn;
 
-    xnm1 = xn;
-    ynm2 = ynm1;
-    ynm1 = yn;
+    yn  = yn * d_;
+    out = yn;
 
-    yn = yn * d;
+    return out;
+}
+
+void Mode::ProcessBlock(const float *in, float *out, size_t size)
+{
+    CalculateCoefficients();
+
+    const float a0 = a0_, a1 = a1_, a2 = a2_, d = d_;
+    float       xnm1 = xnm1_, ynm1 = ynm1_, ynm2 = ynm2_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        const float yn = a0 * xnm1 - a1 * ynm1 - a2 * ynm2;
+
+        xnm1   = in[i];
+        ynm2   = ynm1;
+        ynm1   = yn;
+        out[i] = yn * d;
+    }
 
-    out   = yn;
     xnm1_ = xnm1;
     ynm1_ = ynm1;
     ynm2_ = ynm2;
-    lfq_  = lfq;
-    lq_   = lq;
-    d_    = d;
-    a0_   = a0;
-    a1_   = a1;
-    a2_   = a2;
-    return out;
 }
@@ -2,6 +2,8 @@
 #ifndef DAISY_MODE
 #define DAISY_MODE
 
+#include <stddef.h>
+
 namespace daisysp
 {
 /** Resonant Modal Filter
@@ -30,6 +32,13 @@ class Mode
     */
     float Process(float in);
 
+    /** Processes a block of samples through the filter.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
     /** Clears the filter, returning the output to 0.0
     */
     void Clear();
@@ -44,6 +53,7 @@ class Mode
     inline void SetQ(float q) { q_ = q; }
 
   private:
+    void  CalculateCoefficients();
     float freq_, q_;
     float xnm1_, ynm1_, ynm2_, a0_, a1_, a2_;
     float d_, lfq_, lq_, sr_;
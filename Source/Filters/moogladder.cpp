@@ -40,35 +40,28 @@ void MoogLadder::Init(float sample_rate)
     old_res_  = -1.0f;
 }
 
-float MoogLadder::Process(float in)
-{
-    float  freq = freq_;
-    float  res  = res_;
-    float  res4;
-    float* delay   = delay_;
-    float* tanhstg = tanhstg_;
-    float  stg[4];
-    float  acr, tune;
-
-    float THERMAL = 0.000025;
+static constexpr float kThermal = 0.000025f;
 
+void MoogLadder::UpdateCoefficients(float& res, float& acr, float& tune)
+{
+    res = res_;
     if(res < 0)
     {
         res = 0;
     }
 
-    if(old_freq_ != freq || old_res_ != res)
+    if(old_freq_ != freq_ || old_res_ != res)
     {
         float f, fc, fc2, fc3, fcr;
-        old_freq_ = freq;
-        fc        = (freq / sample_rate_);
+        old_freq_ = freq_;
+        fc        = (freq_ / sample_rate_);
         f         = 0.5f * fc;
         fc2       = fc * fc;
         fc3       = fc2 * fc2;
 
         fcr  = 1.8730f * fc3 + 0.4955f * fc2 - 0.6490f * fc + 0.9988f;
         acr  = -3.9364f * fc2 + 1.8409f * fc + 0.9968f;
-        tune = (1.0f - expf(-((2 * PI_F) * f * fcr))) / THERMAL;
+        tune = (1.0f - LutExp(-((2 * PI_F) * f * fcr))) / kThermal;
 
         old_res_  = res;
         old_acr_  = acr;
@@ -80,22 +73,29 @@ float MoogLadder::Process(float in)
         acr  = old_acr_;
         tune = old_tune_;
     }
+}
 
-    res4 = 4.0f * res * acr;
+inline float MoogLadder::ProcessSample(float  in,
+                                       float  res4,
+                                       float  tune,
+                                       float* delay,
+                                       float* tanhstg)
+{
+    float stg[4];
 
     for(int j = 0; j < 2; j++)
     {
         in -= res4 * delay[5];
         delay[0] = stg[0]
-            = delay[0] + tune * (my_tanh(in * THERMAL) - tanhstg[0]);
+            = delay[0] + tune * (my_tanh(in * kThermal) - tanhstg[0]);
         for(int k = 1; k < 4; k++)
         {
             in     = stg[k - 1];
             stg[k] = delay[k]
                      + tune
-                           * ((tanhstg[k - 1] = my_tanh(in * THERMAL))
+                           * ((tanhstg[k - 1] = my_tanh(in * kThermal))
                               - (k != 3 ? tanhstg[k]
-                                        : my_tanh(delay[k] * THERMAL)));
+                                        : my_tanh(delay[k] * kThermal)));
             delay[k] = stg[k];
         }
         delay[5] = (stg[3] + delay[4]) * 0.5f;
@@ -103,3 +103,83 @@ float MoogLadder::Process(float in)
     }
     return delay[5];
 }
+
+float MoogLadder::Process(float in)
+{
+    float res, acr, tune;
+    UpdateCoefficients(res, acr, tune);
+    return ProcessSample(in, 4.0f * res * acr, tune, delay_, tanhstg_);
+}
+
+void MoogLadder::ProcessBlock(const float* in, float* out, size_t size)
+{
+    float res, acr, tune;
+    UpdateCoefficients(res, acr, tune);
+    ProcessRamp(in, out, size, 4.0f * res * acr, 0.0f, tune, 0.0f);
+}
+
+void MoogLadder::ProcessBlock(const float* in,
+                              float*       out,
+                              size_t       size,
+                              float        freq)
+{
+    /* old_res_ is negative until the coefficients were first computed */
+    if(old_res_ < 0.0f)
+    {
+        SetFreq(freq);
+        ProcessBlock(in, out, size);
+        return;
+    }
+    if(size == 0)
+        return;
+    const float res4_start = 4.0f * old_res_ * old_acr_;
+    const float tune_start = old_tune_;
+
+    float res, acr, tune;
+    SetFreq(freq);
+    UpdateCoefficients(res, acr, tune);
+    const float scale = 1.0f / static_cast<float>(size);
+    ProcessRamp(in,
+                out,
+                size,
+                res4_start,
+                (4.0f * res * acr - res4_start) * scale,
+                tune_start,
+                (tune - tune_start) * scale);
+}
+
+void MoogLadder::ProcessRamp(const float* in,
+                             float*       out,
+                             size_t       size,
+                             float        res4,
+                             float        res4_inc,
+                             float        tune,
+                             float        tune_inc)
+{
+    /* keep the filter state in locals for the duration of the block */
+    float delay[6], tanhstg[3];
+    for(int i = 0; i < 6; i++)
+    {
+        delay[i] = delay_[i];
+    }
+    for(int i = 0; i < 3; i++)
+    {
+        tanhstg[i] = tanhstg_[i];
+    }
+
+    for(size_t i = 0; i < size; i++)
+    {
+        res4 += res4_inc;
+        tune += tune_inc;
+        out[i] = ProcessSample(in[i], res4, tune, delay, tanhstg);
+    }
+
+    for(int i = 0; i < 6; i++)
+    {
+        delay_[i] = delay[i];
+    }
+    for(int i = 0; i < 3; i++)
+    {
+        tanhstg_[i] = tanhstg[i];
+    }
+}
@@ -3,6 +3,7 @@
 #define DSY_MOOGLADDER_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -29,6 +30,24 @@ class MoogLadder
     */
     float Process(float in);
 
+    /** Processes a block of samples through the lowpass filter
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float* in, float* out, size_t size);
+
+    /** Processes a block of samples while the cutoff glides linearly from
+        its current value to freq. The coefficients are computed once, for
+        the end of the block, and interpolated in between, which avoids
+        zipper noise without recomputing them every sample.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+        \param freq - cutoff in Hz at the end of the block
+    */
+    void ProcessBlock(const float* in, float* out, size_t size, float freq);
+
     /** 
         Sets the cutoff frequency or half-way point of the filter.
         Arguments
@@ -44,6 +63,19 @@ class MoogLadder
     float istor_, res_, freq_, delay_[6], tanhstg_[3], old_freq_, old_res_,
         sample_rate_, old_acr_, old_tune_;
     float my_tanh(float x);
+    void  UpdateCoefficients(float& res, float& acr, float& tune);
+    float ProcessSample(float  in,
+                        float  res4,
+                        float  tune,
+                        float* delay,
+                        float* tanhstg);
+    void  ProcessRamp(const float* in,
+                      float*       out,
+                      size_t       size,
+                      float        res4,
+                      float        res4_inc,
+                      float        tune,
+                      float        tune_inc);
 };
 } // namespace daisysp
 #endif
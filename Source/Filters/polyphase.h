@@ -0,0 +1,269 @@
+#pragma once
+#ifndef DSY_POLYPHASE_H
+#define DSY_POLYPHASE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include <assert.h>
+#include "Utility/dsp.h"
+#include "Filters/fir.h"
+#ifdef __cplusplus
+
+/** @file polyphase.h */
+
+namespace daisysp
+{
+/** Kaiser windowed sinc lowpass for integer sample rate conversion.
+
+    Designs the factor * taps_per_phase taps prototype (natural order, unity
+    DC gain) shared by PolyphaseUpsampler and PolyphaseDownsampler.
+    The window (beta = 8) gives about 80 dB of stopband rejection, the
+    cutoff is placed so that the stopband starts at the Nyquist frequency
+    of the base rate. The passband then extends to about
+    (0.5 - 5.1 / taps_per_phase) times the base sample rate.
+    \param h - factor * taps_per_phase output coefficients
+    \param factor - rate conversion factor
+    \param taps_per_phase - length of each polyphase component
+*/
+inline void PolyphaseDesign(float *h, size_t factor, size_t taps_per_phase)
+{
+    const double kBeta = 8.0;
+    const double kPi   = 3.14159265358979323846;
+    const size_t n     = factor * taps_per_phase;
+    /* normalized to the high rate */
+    const double cutoff = (0.5 - 2.55 / taps_per_phase) / factor;
+    const double center = 0.5 * (n - 1);
+
+    /* zeroth order modified Bessel function of the first kind */
+    auto bessel_i0 = [](double x) {
+        double sum = 1.0, term = 1.0;
+        for(int k = 1; k < 50 && term > 1.0e-12 * sum; k++)
+        {
+            term *= (x * x) / (4.0 * k * k);
+            sum += term;
+        }
+        return sum;
+    };
+
+    const double norm = bessel_i0(kBeta);
+    double       sum  = 0.0;
+    for(size_t i = 0; i < n; i++)
+    {
+        const double t    = i - center;
+        const double r    = t / (center + 0.5);
+        const double w    = bessel_i0(kBeta * sqrt(1.0 - r * r)) / norm;
+        const double x    = 2.0 * cutoff * t;
+        const double sinc = fabs(x) < 1.0e-9 ? 1.0 : sin(kPi * x) / (kPi * x);
+        const double tap  = 2.0 * cutoff * sinc * w;
+        h[i]              = static_cast<float>(tap);
+        sum += tap;
+    }
+    for(size_t i = 0; i < n; i++)
+    {
+        h[i] = static_cast<float>(h[i] / sum);
+    }
+}
+
+/** Polyphase interpolator, raises the sample rate by an integer factor.
+
+    Each of the factor phases of the prototype lowpass (see PolyphaseDesign)
+    is a FIRFilterImplCircular of taps_per_phase taps running at the base
+    rate, so no multiplications are spent on the inserted zeros.
+
+    \param factor - oversampling factor, e.g. 2, 4 or 8
+    \param taps_per_phase - filter length per phase, at least 16
+    \param max_block - maximal number of input samples per ProcessBlock()
+*/
+template <size_t factor, size_t taps_per_phase = 32, size_t max_block = 48>
+class PolyphaseUpsampler
+{
+  public:
+    static_assert(factor >= 2, "PolyphaseUpsampler: factor must be >= 2");
+    static_assert(taps_per_phase >= 16,
+                  "PolyphaseUpsampler: taps_per_phase must be >= 16");
+
+    PolyphaseUpsampler() {}
+    ~PolyphaseUpsampler() {}
+
+    /** Designs the filter and clears the state */
+    void Init()
+    {
+        float h[factor * taps_per_phase];
+        float phase[taps_per_phase];
+        PolyphaseDesign(h, factor, taps_per_phase);
+        for(size_t p = 0; p < factor; p++)
+        {
+            /* the zero stuffing loses a factor of gain, restore it here */
+            for(size_t j = 0; j < taps_per_phase; j++)
+            {
+                phase[j] = h[j * factor + p] * factor;
+            }
+            phases_[p].SetIR(phase, taps_per_phase, true);
+        }
+    }
+
+    /** Clears the state (but not the filter) */
+    void Reset()
+    {
+        for(size_t p = 0; p < factor; p++)
+        {
+            phases_[p].Reset();
+        }
+    }
+
+    /** Latency in samples at the high rate */
+    static constexpr float GetLatency()
+    {
+        return 0.5f * (factor * taps_per_phase - 1);
+    }
+
+    /** Upsamples one sample
+        \param in - input sample at the base rate
+        \param out - factor output samples at the high rate
+    */
+    void Process(float in, float *out)
+    {
+        for(size_t p = 0; p < factor; p++)
+        {
+            out[p] = phases_[p].Process(in);
+        }
+    }
+
+    /** Upsamples a block
+        \param in - size input samples at the base rate
+        \param out - size * factor output samples at the high rate
+        \param size - number of input samples, up to max_block
+    */
+    void ProcessBlock(const float *in, float *out, size_t size)
+    {
+        assert(size <= max_block);
+        for(size_t p = 0; p < factor; p++)
+        {
+            phases_[p].ProcessBlock(in, phase_out_, size);
+            for(size_t i = 0; i < size; i++)
+            {
+                out[i * factor + p] = phase_out_[i];
+            }
+        }
+    }
+
+  private:
+    FIRFilterImplCircular<taps_per_phase, max_block> phases_[factor];
+    float                                            phase_out_[max_block];
+};
+
+/** Polyphase decimator, lowers the sample rate by an integer factor.
+
+    The input is split into factor interleaved streams at the base rate,
+    each filtered by one phase of the prototype lowpass (see
+    PolyphaseDesign), so only the kept output samples are computed.
+
+    \param factor - decimation factor, e.g. 2, 4 or 8
+    \param taps_per_phase - filter length per phase, at least 16
+    \param max_block - maximal number of output samples per ProcessBlock()
+*/
+template <size_t factor, size_t taps_per_phase = 32, size_t max_block = 48>
+class PolyphaseDownsampler
+{
+  public:
+    static_assert(factor >= 2, "PolyphaseDownsampler: factor must be >= 2");
+    static_assert(taps_per_phase >= 16,
+                  "PolyphaseDownsampler: taps_per_phase must be >= 16");
+
+    PolyphaseDownsampler() {}
+    ~PolyphaseDownsampler() {}
+
+    /** Designs the filter and clears the state */
+    void Init()
+    {
+        float h[factor * taps_per_phase];
+        float phase[taps_per_phase];
+        PolyphaseDesign(h, factor, taps_per_phase);
+        for(size_t p = 0; p < factor; p++)
+        {
+            for(size_t j = 0; j < taps_per_phase; j++)
+            {
+                phase[j] = h[j * factor + p];
+            }
+            phases_[p].SetIR(phase, taps_per_phase, true);
+        }
+        Reset();
+    }
+
+    /** Clears the state (but not the filter) */
+    void Reset()
+    {
+        for(size_t p = 0; p < factor; p++)
+        {
+            phases_[p].Reset();
+            last_[p] = 0.0f;
+        }
+    }
+
+    /** Latency in samples at the high rate */
+    static constexpr float GetLatency()
+    {
+        return 0.5f * (factor * taps_per_phase - 1);
+    }
+
+    /** Downsamples one frame
+        \param in - factor input samples at the high rate
+        \return output sample at the base rate
+    */
+    float Process(const float *in)
+    {
+        float out;
+        ProcessBlock(in, &out, 1);
+        return out;
+    }
+
+    /** Downsamples a block
+        \param in - size * factor input samples at the high rate
+        \param out - size output samples at the base rate
+        \param size - number of output samples, up to max_block
+    */
+    void ProcessBlock(const float *in, float *out, size_t size)
+    {
+        assert(size <= max_block);
+        if(size == 0)
+            return;
+
+        /* stream 0 holds x[m * factor] */
+        for(size_t m = 0; m < size; m++)
+        {
+            stream_[m] = in[m * factor];
+        }
+        phases_[0].ProcessBlock(stream_, out, size);
+
+        /* stream p holds x[m * factor - p], reaching into the last frame */
+        for(size_t p = 1; p < factor; p++)
+        {
+            stream_[0] = last_[factor - p];
+            for(size_t m = 1; m < size; m++)
+            {
+                stream_[m] = in[m * factor - p];
+            }
+            phases_[p].ProcessBlock(stream_, phase_out_, size);
+            for(size_t m = 0; m < size; m++)
+            {
+                out[m] += phase_out_[m];
+            }
+        }
+
+        for(size_t p = 0; p < factor; p++)
+        {
+            last_[p] = in[(size - 1) * factor + p];
+        }
+    }
+
+  private:
+    FIRFilterImplCircular<taps_per_phase, max_block> phases_[factor];
+    float                                            last_[factor];
+    float                                            stream_[max_block];
+    float                                            phase_out_[max_block];
+};
+
+} // namespace daisysp
+#endif
+#endif
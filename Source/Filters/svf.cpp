@@ -55,16 +55,125 @@ void Svf::Process(float in)
     out_notch_ += 0.5f * notch_;
 }
 
+void Svf::ProcessBlock(const float *in,
+                       float *      low,
+                       float *      high,
+                       float *      band,
+                       float *      notch,
+                       float *      peak,
+                       size_t       size)
+{
+    ProcessRamp(in, low, high, band, notch, peak, size, freq_, 0.f, damp_, 0.f);
+}
+
+void Svf::ProcessBlock(const float *in,
+                       float *      low,
+                       float *      high,
+                       float *      band,
+                       float *      notch,
+                       float *      peak,
+                       size_t       size,
+                       float        freq)
+{
+    if(size == 0)
+        return;
+    const float freq_start = freq_;
+    const float damp_start = damp_;
+    SetFreq(freq);
+    const float scale = 1.0f / static_cast<float>(size);
+    ProcessRamp(in,
+                low,
+                high,
+                band,
+                notch,
+                peak,
+                size,
+                freq_start,
+                (freq_ - freq_start) * scale,
+                damp_start,
+                (damp_ - damp_start) * scale);
+}
+
+void Svf::ProcessRamp(const float *in,
+                      float *      low,
+                      float *      high,
+                      float *      band,
+                      float *      notch,
+                      float *      peak,
+                      size_t       size,
+                      float        freq,
+                      float        freq_inc,
+                      float        damp,
+                      float        damp_inc)
+{
+    const float drive = drive_;
+
+    float s_notch = notch_, s_low = low_, s_high = high_, s_band = band_;
+    float o_low = out_low_, o_high = out_high_, o_band = out_band_;
+    float o_notch = out_notch_, o_peak = out_peak_;
+    float x = input_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        freq += freq_inc;
+        damp += damp_inc;
+
+        x = in[i];
+        // first pass
+        s_notch = x - damp * s_band;
+        s_low   = s_low + freq * s_band;
+        s_high  = s_notch - s_low;
+        s_band  = freq * s_high + s_band - drive * s_band * s_band * s_band;
+        // take first sample of output
+        o_low   = 0.5f * s_low;
+        o_high  = 0.5f * s_high;
+        o_band  = 0.5f * s_band;
+        o_peak  = 0.5f * (s_low - s_high);
+        o_notch = 0.5f * s_notch;
+        // second pass
+        s_notch = x - damp * s_band;
+        s_low   = s_low + freq * s_band;
+        s_high  = s_notch - s_low;
+        s_band  = freq * s_high + s_band - drive * s_band * s_band * s_band;
+        // average second pass outputs
+        o_low += 0.5f * s_low;
+        o_high += 0.5f * s_high;
+        o_band += 0.5f * s_band;
+        o_peak += 0.5f * (s_low - s_high);
+        o_notch += 0.5f * s_notch;
+
+        if(low)
+            low[i] = o_low;
+        if(high)
+            high[i] = o_high;
+        if(band)
+            band[i] = o_band;
+        if(notch)
+            notch[i] = o_notch;
+        if(peak)
+            peak[i] = o_peak;
+    }
+
+    input_     = x;
+    notch_     = s_notch;
+    low_       = s_low;
+    high_      = s_high;
+    band_      = s_band;
+    out_low_   = o_low;
+    out_high_  = o_high;
+    out_band_  = o_band;
+    out_notch_ = o_notch;
+    out_peak_  = o_peak;
+}
+
 void Svf::SetFreq(float f)
 {
     fc_ = fclamp(f, 1.0e-6, fc_max_);
     // Set Internal Frequency for fc_
-    freq_ = 2.0f
-            * sinf(PI_F
-                   * MIN(0.25f,
-                         fc_ / (sr_ * 2.0f))); // fs*2 because double sampled
+    // sin(PI_F * x) is LutSin(x / 2), fs*2 because double sampled
+    freq_ = 2.0f * LutSin(0.5f * MIN(0.25f, fc_ / (sr_ * 2.0f)));
     // recalculate damp
-    damp_ = MIN(2.0f * (1.0f - powf(res_, 0.25f)),
+    damp_ = MIN(2.0f * (1.0f - sqrtf(sqrtf(res_))),
                 MIN(2.0f, 2.0f / freq_ - freq_ * 0.5f));
 }
 
@@ -73,7 +182,7 @@ void Svf::SetRes(float r)
     float res = fclamp(r, 0.f, 1.f);
     res_      = res;
     // recalculate damp
-    damp_  = MIN(2.0f * (1.0f - powf(res_, 0.25f)),
+    damp_  = MIN(2.0f * (1.0f - sqrtf(sqrtf(res_))),
                 MIN(2.0f, 2.0f / freq_ - freq_ * 0.5f));
     drive_ = pre_drive_ * res_;
 }
@@ -2,6 +2,8 @@
 #ifndef DSY_SVF_H
 #define DSY_SVF_H
 
+#include <stddef.h>
+
 namespace daisysp
 {
 /**      Double Sampled, Stable State Variable Filter
@@ -31,6 +33,68 @@ class Svf
     */
     void Process(float in);
 
+    /** Process a block of the input signal, writing any of the outputs.
+        Any output pointer may be nullptr if that output is not needed.
+        After the call Low(), High() etc. return the last sample of the block.
+        \param in - input buffer
+        \param low - low pass output buffer or nullptr
+        \param high - high pass output buffer or nullptr
+        \param band - band pass output buffer or nullptr
+        \param notch - notch output buffer or nullptr
+        \param peak - peak output buffer or nullptr
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in,
+                      float *      low,
+                      float *      high,
+                      float *      band,
+                      float *      notch,
+                      float *      peak,
+                      size_t       size);
+
+    /** Process a block of the input signal, writing the low pass output.
+        \param in - input buffer, may be the same as out
+        \param out - low pass output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size)
+    {
+        ProcessBlock(in, out, nullptr, nullptr, nullptr, nullptr, size);
+    }
+
+    /** Process a block while the cutoff glides linearly from its current
+        value to freq. The coefficients are computed once, for the end of
+        the block, and interpolated in between, which avoids zipper noise
+        without calling SetFreq() every sample.
+        \param in - input buffer
+        \param low - low pass output buffer or nullptr
+        \param high - high pass output buffer or nullptr
+        \param band - band pass output buffer or nullptr
+        \param notch - notch output buffer or nullptr
+        \param peak - peak output buffer or nullptr
+        \param size - number of samples to process
+        \param freq - cutoff in Hz at the end of the block
+    */
+    void ProcessBlock(const float *in,
+                      float *      low,
+                      float *      high,
+                      float *      band,
+                      float *      notch,
+                      float *      peak,
+                      size_t       size,
+                      float        freq);
+
+    /** Process a block with a cutoff glide, writing the low pass output.
+        \param in - input buffer, may be the same as out
+        \param out - low pass output buffer
+        \param size - number of samples to process
+        \param freq - cutoff in Hz at the end of the block
+    */
+    void ProcessBlock(const float *in, float *out, size_t size, float freq)
+    {
+        ProcessBlock(in, out, nullptr, nullptr, nullptr, nullptr, size, freq);
+    }
+
 
     /** sets the frequency of the cutoff frequency. 
         f must be between 0.0 and sample_rate / 3
@@ -68,6 +132,18 @@ class Svf
     inline float Peak() { return out_peak_; }
 
   private:
+    void ProcessRamp(const float *in,
+                     float *      low,
+                     float *      high,
+                     float *      band,
+                     float *      notch,
+                     float *      peak,
+                     size_t       size,
+                     float        freq,
+                     float        freq_inc,
+                     float        damp,
+                     float        damp_inc);
+
     float sr_, fc_, res_, drive_, freq_, damp_;
     float notch_, low_, high_, band_, peak_;
     float input_;
@@ -0,0 +1,250 @@
+#pragma once
+#ifndef DSY_SVFBANK_H
+#define DSY_SVFBANK_H
+
+#include <stddef.h>
+#include <math.h>
+#include "Utility/dsp.h"
+#include "Utility/simd.h"
+#ifdef __cplusplus
+
+/** @file svfbank.h */
+
+namespace daisysp
+{
+/** Bank of num_voices independent Svf filters.
+
+    Each voice behaves exactly like an Svf (double sampled, stable state
+    variable filter) with its own frequency, resonance and drive. State and
+    coefficients are stored structure-of-arrays style so that 4 or 8 voices
+    are processed at once with SSE/AVX/NEON, see Utility/simd.h.
+
+    Audio is exchanged as interleaved frames: sample s of voice v lives at
+    index s * num_voices + v.
+
+    \param num_voices - number of filters in the bank, a multiple of 4.
+*/
+template <size_t num_voices>
+class SvfBank
+{
+  public:
+    static_assert(num_voices > 0 && num_voices % 4 == 0,
+                  "SvfBank: number of voices must be a multiple of 4");
+
+    SvfBank() {}
+    ~SvfBank() {}
+
+    /** Initializes all filters
+        \param sample_rate - sample rate of the audio engine being run.
+    */
+    void Init(float sample_rate)
+    {
+        sr_     = sample_rate;
+        fc_max_ = sr_ / 3.f;
+        for(size_t v = 0; v < num_voices; v++)
+        {
+            fc_[v]        = 200.0f;
+            res_[v]       = 0.5f;
+            drive_[v]     = 0.5f;
+            pre_drive_[v] = 0.5f;
+            freq_[v]      = 0.25f;
+            damp_[v]      = 0.0f;
+            low_[v]       = 0.0f;
+            band_[v]      = 0.0f;
+            out_low_[v]   = 0.0f;
+            out_high_[v]  = 0.0f;
+            out_band_[v]  = 0.0f;
+            out_notch_[v] = 0.0f;
+            out_peak_[v]  = 0.0f;
+        }
+    }
+
+    /** Sets the cutoff frequency of one voice.
+        \param voice - voice index, 0 to num_voices - 1
+        \param f - frequency in Hz, between 0.0 and sample_rate / 3
+    */
+    void SetFreq(size_t voice, float f)
+    {
+        fc_[voice] = fclamp(f, 1.0e-6f, fc_max_);
+        // fs*2 because double sampled
+        const float fc = fc_[voice] / (sr_ * 2.0f);
+        freq_[voice]   = 2.0f * LutSin(0.5f * DSY_MIN(0.25f, fc));
+        UpdateDamp(voice);
+    }
+
+    /** Sets the cutoff frequency of all voices. */
+    void SetFreq(float f)
+    {
+        for(size_t v = 0; v < num_voices; v++)
+            SetFreq(v, f);
+    }
+
+    /** Sets the resonance of one voice.
+        \param voice - voice index, 0 to num_voices - 1
+        \param r - resonance, between 0.0 and 1.0
+    */
+    void SetRes(size_t voice, float r)
+    {
+        res_[voice] = fclamp(r, 0.f, 1.f);
+        UpdateDamp(voice);
+        drive_[voice] = pre_drive_[voice] * res_[voice];
+    }
+
+    /** Sets the resonance of all voices. */
+    void SetRes(float r)
+    {
+        for(size_t v = 0; v < num_voices; v++)
+            SetRes(v, r);
+    }
+
+    /** Sets the drive of one voice.
+        \param voice - voice index, 0 to num_voices - 1
+        \param d - drive, affects the response of the resonance
+    */
+    void SetDrive(size_t voice, float d)
+    {
+        pre_drive_[voice] = fclamp(d * 0.1f, 0.f, 1.f);
+        drive_[voice]     = pre_drive_[voice] * res_[voice];
+    }
+
+    /** Sets the drive of all voices. */
+    void SetDrive(float d)
+    {
+        for(size_t v = 0; v < num_voices; v++)
+            SetDrive(v, d);
+    }
+
+    /** Processes one sample per voice, updating all of the outputs.
+        \param in - num_voices input samples, one per voice
+    */
+    void Process(const float *in)
+    {
+        ProcessBlock(
+            in, out_low_, out_high_, out_band_, out_notch_, out_peak_, 1);
+    }
+
+    /** Processes a block of interleaved frames, writing any of the outputs.
+        Any output pointer may be nullptr if that output is not needed.
+        After the call Low(), High() etc. return the last frame of the block.
+        \param in - size * num_voices interleaved input samples
+        \param low - low pass output frames or nullptr
+        \param high - high pass output frames or nullptr
+        \param band - band pass output frames or nullptr
+        \param notch - notch output frames or nullptr
+        \param peak - peak output frames or nullptr
+        \param size - number of frames to process
+    */
+    void ProcessBlock(const float *in,
+                      float *      low,
+                      float *      high,
+                      float *      band,
+                      float *      notch,
+                      float *      peak,
+                      size_t       size)
+    {
+        if(size == 0)
+            return;
+
+        const Vec half(0.5f);
+        for(size_t lane = 0; lane < num_voices; lane += kWidth)
+        {
+            const Vec freq   = Vec::Load(freq_ + lane);
+            const Vec damp   = Vec::Load(damp_ + lane);
+            const Vec drive  = Vec::Load(drive_ + lane);
+            Vec       s_low  = Vec::Load(low_ + lane);
+            Vec       s_band = Vec::Load(band_ + lane);
+            Vec       o_low, o_high, o_band, o_notch, o_peak;
+
+            for(size_t i = 0, idx = lane; i < size; i++, idx += num_voices)
+            {
+                const Vec x = Vec::Load(in + idx);
+                // first pass
+                Vec s_notch = x - damp * s_band;
+                s_low       = s_low + freq * s_band;
+                Vec s_high  = s_notch - s_low;
+                s_band = freq * s_high + s_band
+                         - drive * s_band * s_band * s_band;
+                // take first sample of output
+                o_low   = half * s_low;
+                o_high  = half * s_high;
+                o_band  = half * s_band;
+                o_peak  = half * (s_low - s_high);
+                o_notch = half * s_notch;
+                // second pass
+                s_notch = x - damp * s_band;
+                s_low   = s_low + freq * s_band;
+                s_high  = s_notch - s_low;
+                s_band = freq * s_high + s_band
+                         - drive * s_band * s_band * s_band;
+                // average second pass outputs
+                o_low   = o_low + half * s_low;
+                o_high  = o_high + half * s_high;
+                o_band  = o_band + half * s_band;
+                o_peak  = o_peak + half * (s_low - s_high);
+                o_notch = o_notch + half * s_notch;
+
+                if(low)
+                    o_low.Store(low + idx);
+                if(high)
+                    o_high.Store(high + idx);
+                if(band)
+                    o_band.Store(band + idx);
+                if(notch)
+                    o_notch.Store(notch + idx);
+                if(peak)
+                    o_peak.Store(peak + idx);
+            }
+
+            s_low.Store(low_ + lane);
+            s_band.Store(band_ + lane);
+            o_low.Store(out_low_ + lane);
+            o_high.Store(out_high_ + lane);
+            o_band.Store(out_band_ + lane);
+            o_notch.Store(out_notch_ + lane);
+            o_peak.Store(out_peak_ + lane);
+        }
+    }
+
+    /** low pass output of one voice */
+    inline float Low(size_t voice) const { return out_low_[voice]; }
+    /** high pass output of one voice */
+    inline float High(size_t voice) const { return out_high_[voice]; }
+    /** band pass output of one voice */
+    inline float Band(size_t voice) const { return out_band_[voice]; }
+    /** notch output of one voice */
+    inline float Notch(size_t voice) const { return out_notch_[voice]; }
+    /** peak output of one voice */
+    inline float Peak(size_t voice) const { return out_peak_[voice]; }
+
+    /** low pass outputs of all voices */
+    inline const float *Low() const { return out_low_; }
+    /** high pass outputs of all voices */
+    inline const float *High() const { return out_high_; }
+    /** band pass outputs of all voices */
+    inline const float *Band() const { return out_band_; }
+    /** notch outputs of all voices */
+    inline const float *Notch() const { return out_notch_; }
+    /** peak outputs of all voices */
+    inline const float *Peak() const { return out_peak_; }
+
+  private:
+    static constexpr size_t kWidth = simd::LaneWidth<num_voices>::value;
+    typedef simd::FloatVec<kWidth> Vec;
+
+    void UpdateDamp(size_t voice)
+    {
+        const float freq = freq_[voice];
+        damp_[voice]     = DSY_MIN(2.0f * (1.0f - sqrtf(sqrtf(res_[voice]))),
+                               DSY_MIN(2.0f, 2.0f / freq - freq * 0.5f));
+    }
+
+    float sr_, fc_max_;
+    float fc_[num_voices], res_[num_voices], pre_drive_[num_voices];
+    float freq_[num_voices], damp_[num_voices], drive_[num_voices];
+    float low_[num_voices], band_[num_voices];
+    float out_low_[num_voices], out_high_[num_voices], out_band_[num_voices];
+    float out_notch_[num_voices], out_peak_[num_voices];
+};
+} // namespace daisysp
+#endif
+#endif
@@ -3,6 +3,7 @@
 #define DSY_TONE_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -25,6 +26,24 @@ class Tone
     */
     float Process(float &in);
 
+    /** Processes a block of samples through the filter.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
+    /** Processes a block of samples while the cutoff glides linearly from
+        its current value to freq. The coefficient is computed once, for
+        the end of the block, and interpolated in between, which avoids
+        zipper noise at the cost of an add per sample.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+        \param freq - cutoff in Hz at the end of the block
+    */
+    void ProcessBlock(const float *in, float *out, size_t size, float freq);
+
     /** Sets the cutoff frequency or half-way point of the filter.
 
         \param freq - frequency value in Hz. Range: Any positive value.
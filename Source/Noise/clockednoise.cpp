@@ -7,6 +7,7 @@ using namespace daisysp;
 void ClockedNoise::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
+    rng_.Reset();
 
     phase_       = 0.0f;
     sample_      = 0.0f;
@@ -22,7 +23,7 @@ float ClockedNoise::Process()
     float this_sample = next_sample;
     next_sample       = 0.0f;
 
-    const float raw_sample = rand() * kRandFrac * 2.0f - 1.0f;
+    const float raw_sample = rng_.NextBipolar();
     float       raw_amount = 4.0f * (frequency_ - 0.25f);
     raw_amount             = fclamp(raw_amount, 0.0f, 1.0f);
 
@@ -46,6 +47,44 @@ float ClockedNoise::Process()
     return this_sample + raw_amount * (raw_sample - this_sample);
 }
 
+void ClockedNoise::Render(float *out, size_t size)
+{
+    const float frequency  = frequency_;
+    const float raw_amount = fclamp(4.0f * (frequency - 0.25f), 0.0f, 1.0f);
+
+    float phase       = phase_;
+    float sample      = sample_;
+    float next_sample = next_sample_;
+
+    // the random numbers are generated up front, where they vectorize
+    rng_.FillBipolar(out, size);
+    for(size_t i = 0; i < size; i++)
+    {
+        const float raw_sample  = out[i];
+        float       this_sample = next_sample;
+        next_sample             = 0.0f;
+
+        phase += frequency;
+
+        if(phase >= 1.0f)
+        {
+            phase -= 1.0f;
+            float t             = phase / frequency;
+            float discontinuity = raw_sample - sample;
+            this_sample += discontinuity * ThisBlepSample(t);
+            next_sample += discontinuity * NextBlepSample(t);
+            sample = raw_sample;
+        }
+
+        next_sample += sample;
+        out[i] = this_sample + raw_amount * (raw_sample - this_sample);
+    }
+
+    phase_       = phase;
+    sample_      = sample;
+    next_sample_ = next_sample;
+}
+
 void ClockedNoise::SetFreq(float freq)
 {
     freq       = freq / sample_rate_;
@@ -3,6 +3,8 @@
 #define DSY_CLOCKEDNOISE_H
 
 #include <stdint.h>
+#include <stddef.h>
+#include "Utility/random.h"
 #ifdef __cplusplus
 
 /** @file clockednoise.h */
@@ -32,6 +34,12 @@ class ClockedNoise
     /** Get the next floating point sample */
     float Process();
 
+    /** Fills a block with noise, the same samples Process() would return.
+        \param out - output buffer
+        \param size - number of samples
+    */
+    void Render(float *out, size_t size);
+
     /** Set the frequency at which the next sample is generated.
         \param freq Frequency in Hz
     */
@@ -40,6 +48,9 @@ class ClockedNoise
     /** Calling this forces another random float to be generated */
     void Sync();
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
     // Oscillator state.
     float phase_;
@@ -51,7 +62,7 @@ class ClockedNoise
 
     float sample_rate_;
 
-    static constexpr float kRandFrac = 1.f / (float)RAND_MAX;
+    Random rng_;
 };
 } // namespace daisysp
 #endif
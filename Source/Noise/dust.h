@@ -4,6 +4,8 @@
 #include <cstdlib>
 #include <random>
 #include "Utility/dsp.h"
+#include "Utility/random.h"
+#include "Utility/simd.h"
 #ifdef __cplusplus
 
 /** @file dust.h */
@@ -26,12 +28,16 @@ class Dust
     Dust() {}
     ~Dust() {}
 
-    void Init() { SetDensity(.5f); }
+    void Init()
+    {
+        SetDensity(.5f);
+        rng_.Reset();
+    }
 
     float Process()
     {
         float inv_density = 1.0f / density_;
-        float u           = rand() * kRandFrac;
+        float u           = rng_.NextFloat();
         if(u < density_)
         {
             return u * inv_density;
@@ -39,15 +45,46 @@ class Dust
         return 0.0f;
     }
 
+    /** Fills a block with dust, the same samples Process() would return.
+        \param out - output buffer
+        \param size - number of samples
+    */
+    void Render(float *out, size_t size)
+    {
+        typedef simd::FloatVec<simd::kNativeWidth> Vec;
+
+        const float density     = density_;
+        const float inv_density = density > 0.0f ? 1.0f / density : 0.0f;
+        rng_.Fill(out, size);
+
+        // the comparison is done with Step(), the compiler does not turn
+        // the conditional into a vector select by itself
+        const Vec vdensity(density), vinv_density(inv_density), one(1.0f);
+        size_t    i = 0;
+        for(; i + Vec::kWidth <= size; i += Vec::kWidth)
+        {
+            const Vec u = Vec::Load(out + i);
+            (u * vinv_density * (one - Step(vdensity, u))).Store(out + i);
+        }
+        for(; i < size; i++)
+        {
+            const float u = out[i];
+            out[i]        = u < density ? u * inv_density : 0.0f;
+        }
+    }
+
     void SetDensity(float density)
     {
         density_ = fclamp(density, 0.f, 1.f);
         density_ = density_ * .3f;
     }
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
-    float                  density_;
-    static constexpr float kRandFrac = 1.f / (float)RAND_MAX;
+    float  density_;
+    Random rng_;
 };
 } // namespace daisysp
 #endif
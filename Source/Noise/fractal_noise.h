@@ -3,6 +3,8 @@
 #define DSY_FRACTAL_H
 
 #include <stdint.h>
+#include <stddef.h>
+#include "Utility/random.h"
 #ifdef __cplusplus
 
 /** @file fractal_noise.h */
@@ -13,7 +15,7 @@ namespace daisysp
        @brief Fractal Noise, stacks octaves of a noise source.
        @author Ported by Ben Sergentanis 
        @date Jan 2021 
-       T is the noise source to use. T must have SetFreq() and Init(sample_rate) functions. \n
+       T is the noise source to use. T must have SetFreq(), SetSeed() and Init(sample_rate) functions. \n
        Order is the number of noise sources to stack. \n \n
        Ported from pichenettes/eurorack/plaits/dsp/noise/fractal_random_generator.h \n
        to an independent module. \n
@@ -24,7 +26,8 @@ template <typename T, int order>
 class FractalRandomGenerator
 {
   public:
-    FractalRandomGenerator() {}
+    // The octaves start from different seeds, see SetSeed()
+    FractalRandomGenerator() { SetSeed(Random::kDefaultSeed); }
     ~FractalRandomGenerator() {}
 
     /** Initialize the module
@@ -60,6 +63,44 @@ class FractalRandomGenerator
         return sum;
     }
 
+    /** Fills a block with samples, the same ones Process() would return.
+        T must have a Render(float *out, size_t size) function. Each octave
+        renders a run of samples at a time, instead of being updated and
+        called once per sample.
+        \param out - output buffer
+        \param size - number of samples
+    */
+    void Render(float *out, size_t size)
+    {
+        float octave[kBlockChunk];
+        while(size > 0)
+        {
+            const size_t todo      = size < kBlockChunk ? size : kBlockChunk;
+            float        gain      = 0.5f;
+            float        frequency = frequency_;
+
+            generator_[0].SetFreq(frequency);
+            generator_[0].Render(out, todo);
+            for(size_t j = 0; j < todo; j++)
+            {
+                out[j] *= gain;
+            }
+            for(int i = 1; i < order; ++i)
+            {
+                gain *= decay_;
+                frequency *= 2.0f;
+                generator_[i].SetFreq(frequency);
+                generator_[i].Render(octave, todo);
+                for(size_t j = 0; j < todo; j++)
+                {
+                    out[j] += octave[j] * gain;
+                }
+            }
+            out += todo;
+            size -= todo;
+        }
+    }
+
     /** Set the lowest noise frequency.
         \param freq Frequency of the lowest noise source in Hz.
     */
@@ -70,7 +111,20 @@ class FractalRandomGenerator
     */
     void SetColor(float color) { decay_ = fclamp(color, 0.f, 1.f); }
 
+    /** Seeds the noise sources, see Random::SetSeed(). Octave i gets
+        seed + i.
+    */
+    void SetSeed(uint32_t seed)
+    {
+        for(int i = 0; i < order; ++i)
+        {
+            generator_[i].SetSeed(seed + i);
+        }
+    }
+
   private:
+    static constexpr size_t kBlockChunk = 48;
+
     float sample_rate_;
     float frequency_;
     float decay_;
@@ -7,6 +7,7 @@ using namespace daisysp;
 void Particle::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
+    rng_.Reset();
 
     sync_ = false;
     aux_  = 0.f;
@@ -26,7 +27,7 @@ void Particle::Init(float sample_rate)
 
 float Particle::Process()
 {
-    float u = rand() * kRandFrac;
+    float u = rng_.NextFloat();
     float s = 0.0f;
 
     if(u <= density_ || sync_)
@@ -37,13 +38,7 @@ float Particle::Process()
         if(rand_phase_ >= 1.f || sync_)
         {
             rand_phase_ = rand_phase_ >= 1.f ? rand_phase_ - 1.f : rand_phase_;
-
-            const float u = 2.0f * rand() * kRandFrac - 1.0f;
-            const float f
-                = fmin(powf(2.f, kRatioFrac * spread_ * u) * frequency_, .25f);
-            pre_gain_ = 0.5f / sqrtf(resonance_ * f * sqrtf(density_));
-            filter_.SetFreq(f * sample_rate_);
-            filter_.SetRes(resonance_);
+            Retune();
         }
     }
     aux_ = s;
@@ -52,6 +47,24 @@ float Particle::Process()
     return filter_.Band();
 }
 
+void Particle::Render(float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process();
+    }
+}
+
+void Particle::Retune()
+{
+    const float u = rng_.NextBipolar();
+    const float f
+        = fmin(powf(2.f, kRatioFrac * spread_ * u) * frequency_, .25f);
+    pre_gain_ = 0.5f / sqrtf(resonance_ * f * sqrtf(density_));
+    filter_.SetFreq(f * sample_rate_);
+    filter_.SetRes(resonance_);
+}
+
 float Particle::GetNoise()
 {
     return aux_;
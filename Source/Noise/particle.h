@@ -3,7 +3,9 @@
 #define DSY_PARTICLE_H
 
 #include "Filters/svf.h"
+#include "Utility/random.h"
 #include <stdint.h>
+#include <stddef.h>
 #include <cstdlib>
 #ifdef __cplusplus
 
@@ -34,6 +36,13 @@ class Particle
     /** Get the next sample */
     float Process();
 
+    /** Fills a block with output samples, same as calling Process() size
+        times
+        \param out - output buffer
+        \param size - number of samples
+    */
+    void Render(float *out, size_t size);
+
     /** Get the raw noise output. Must call Process() first. */
     float GetNoise();
 
@@ -72,10 +81,15 @@ class Particle
     */
     void SetSync(bool sync);
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
-    static constexpr float kRandFrac  = 1.f / (float)RAND_MAX;
     static constexpr float kRatioFrac = 1.f / 12.f;
-    float                  sample_rate_;
+
+    void Retune();
+
+    float sample_rate_;
     float aux_, frequency_, density_, gain_, spread_, resonance_;
     bool  sync_;
 
@@ -84,8 +98,9 @@ class Particle
     float rand_freq_;
 
 
-    float pre_gain_;
-    Svf   filter_;
+    float  pre_gain_;
+    Svf    filter_;
+    Random rng_;
 };
 } // namespace daisysp
 #endif
@@ -14,27 +14,7 @@ float SIDNoise::Process()
     {
         phase_ -= TWOPI_F;
         eoc_ = true;
-
-        noiseout = (bit(reg,22) << 7) |
-            (bit(reg,20) << 6) |
-            (bit(reg,16) << 5) |
-            (bit(reg,13) << 4) |
-            (bit(reg,11) << 3) |
-            (bit(reg, 7) << 2) |
-            (bit(reg, 4) << 1) |
-            (bit(reg, 2) << 0);
-
-        /* Save bits used to feed bit 0 */
-        bit22= bit(reg,22);
-        bit17= bit(reg,17);
-
-        /* Shift 1 bit left */
-        reg= reg << 1;
-
-        /* Feed bit 0 */
-        reg= reg | (bit22 ^ bit17); 
-
-        out = sid_u82f(noiseout);       
+        out  = Clock();
     }
     else
     {
@@ -45,6 +25,56 @@ float SIDNoise::Process()
     return out * amp_;
 }
 
+void SIDNoise::Render(float *buf, size_t size)
+{
+    const float phase_inc = phase_inc_;
+    const float amp       = amp_;
+
+    float phase = phase_;
+    float value = out * amp;
+    bool  eoc   = eoc_;
+    for(size_t i = 0; i < size; i++)
+    {
+        phase += phase_inc;
+        eoc = phase > TWOPI_F;
+        if(eoc)
+        {
+            phase -= TWOPI_F;
+            out   = Clock();
+            value = out * amp;
+        }
+        buf[i] = value;
+    }
+    phase_ = phase;
+    eoc_   = eoc;
+    eor_   = (phase - phase_inc < PI_F && phase >= PI_F);
+}
+
+/** Steps the shift register and returns the new output, from 0 to 1 */
+float SIDNoise::Clock()
+{
+    noiseout = (bit(reg,22) << 7) |
+        (bit(reg,20) << 6) |
+        (bit(reg,16) << 5) |
+        (bit(reg,13) << 4) |
+        (bit(reg,11) << 3) |
+        (bit(reg, 7) << 2) |
+        (bit(reg, 4) << 1) |
+        (bit(reg, 2) << 0);
+
+    /* Save bits used to feed bit 0 */
+    bit22= bit(reg,22);
+    bit17= bit(reg,17);
+
+    /* Shift 1 bit left */
+    reg= reg << 1;
+
+    /* Feed bit 0 */
+    reg= reg | (bit22 ^ bit17); 
+
+    return sid_u82f(noiseout);
+}
+
 long SIDNoise::bit(long val, int8_t bitnr) 
 {
   return (val & (1<<bitnr))? 1:0;
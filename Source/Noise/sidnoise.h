@@ -2,6 +2,7 @@
 #ifndef DSY_SIDNOISE_H
 #define DSY_SIDNOISE_H
 #include <stdint.h>
+#include <stddef.h>
 #include "../Utility/dsp.h"
 #ifdef __cplusplus
 
@@ -65,7 +66,14 @@ class SIDNoise
     */
     float Process();
 
+    /** Fills a block with samples, the same ones Process() would return.
+        \param buf - output buffer
+        \param size - number of samples
+    */
+    void Render(float *buf, size_t size);
+
   private:
+    float   Clock();
     float   CalcPhaseInc(float f);
     long    bit(long val, int8_t bitnr);
     float   amp_, freq_;
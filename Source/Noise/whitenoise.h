@@ -2,6 +2,8 @@
 #ifndef DSY_WHITENOISE_H
 #define DSY_WHITENOISE_H
 #include <stdint.h>
+#include <stddef.h>
+#include "Utility/random.h"
 #ifdef __cplusplus
 namespace daisysp
 {
@@ -18,8 +20,8 @@ class WhiteNoise
     */
     void Init()
     {
-        amp_      = 1.0f;
-        randseed_ = 1;
+        amp_ = 1.0f;
+        rng_.Reset();
     }
 
     /** sets the amplitude of the noise output
@@ -27,16 +29,21 @@ class WhiteNoise
     inline void SetAmp(float a) { amp_ = a; }
     /** returns a new sample of noise in the range of -amp_ to amp_
     */
-    inline float Process()
-    {
-        randseed_ *= 16807;
-        return (randseed_ * coeff_) * amp_;
-    }
+    inline float Process() { return rng_.NextBipolar() * amp_; }
+
+    /** Fills a block with noise, the same samples Process() would return.
+        The samples are computed independently, so this vectorizes.
+        \param out - output buffer
+        \param size - number of samples
+    */
+    void Render(float *out, size_t size) { rng_.FillBipolar(out, size, amp_); }
+
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
 
   private:
-    static constexpr float coeff_ = 4.6566129e-010f;
-    float                  amp_;
-    int32_t                randseed_;
+    float  amp_;
+    Random rng_;
 };
 } // namespace daisysp
 #endif
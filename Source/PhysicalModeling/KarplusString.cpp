@@ -5,17 +5,26 @@
 
 using namespace daisysp;
 
+#if !defined(DSY_DELAY_USER_MEMORY)
 void String::Init(float sample_rate)
+{
+    Init(sample_rate, buffer_, kDelayLineSize + kDelayLineSize / 4);
+}
+#endif
+
+void String::Init(float sample_rate, float *buffer, size_t size)
 {
     sample_rate_ = sample_rate;
+    rng_.Reset();
 
     SetFreq(440.f);
     non_linearity_amount_ = .5f;
     brightness_           = .5f;
     damping_              = .5f;
 
-    string_.Init();
-    stretch_.Init();
+    // the stretch line is a quarter of the string line
+    string_.Init(buffer, size * 4 / 5);
+    stretch_.Init(buffer + string_.GetSize(), string_.GetSize() / 4);
     Reset();
 
     SetFreq(440.f);
@@ -26,6 +35,13 @@ void String::Init(float sample_rate)
     crossfade_.Init();
 }
 
+size_t String::GetBufferSize(float sample_rate)
+{
+    size_t size
+        = get_next_power2((uint32_t)(kDelayLineSize * sample_rate / 48000.f));
+    return size + size / 4;
+}
+
 void String::Reset()
 {
     string_.Reset();
@@ -82,7 +98,7 @@ float String::ProcessInternal(const float in)
     float brightness = brightness_;
 
     float delay = 1.0f / frequency_;
-    delay       = fclamp(delay, 4.f, kDelayLineSize - 4.0f);
+    delay       = fclamp(delay, 4.f, string_.GetSize() - 4.0f);
 
     // If there is not enough delay time in the delay line, we play at the
     // lowest possible note and we upsample on the fly with a shitty linear
@@ -143,7 +159,7 @@ float String::ProcessInternal(const float in)
 
         if(non_linearity == NON_LINEARITY_DISPERSION)
         {
-            float noise = rand() * kRandFrac - 0.5f;
+            float noise = rng_.NextFloat() - 0.5f;
             fonepole(dispersion_noise_, noise, noise_filter);
             delay *= 1.0f + dispersion_noise_ * noise_amount;
         }
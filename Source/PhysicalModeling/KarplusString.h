@@ -9,6 +9,7 @@
 #include "Utility/delayline.h"
 #include "Filters/svf.h"
 #include "Filters/tone.h"
+#include "Utility/random.h"
 
 #ifdef __cplusplus
 
@@ -31,10 +32,24 @@ class String
     String() {}
     ~String() {}
 
+#if !defined(DSY_DELAY_USER_MEMORY)
     /** Initialize the module.
         \param sample_rate Audio engine sample rate
     */
     void Init(float sample_rate);
+#endif
+
+    /** Initialize the module with user-provided delay memory.
+        \param sample_rate Audio engine sample rate
+        \param buffer Delay memory, must outlive the string.
+        \param size Length of buffer in samples, see GetBufferSize().
+    */
+    void Init(float sample_rate, float *buffer, size_t size);
+
+    /** Returns the delay memory in samples that gives the same lowest
+        pitch at sample_rate as the built-in memory does at 48kHz.
+    */
+    static size_t GetBufferSize(float sample_rate);
 
     /** Clear the delay line */
     void Reset();
@@ -64,6 +79,9 @@ class String
     */
     void SetDamping(float damping);
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
 
   private:
     static constexpr size_t kDelayLineSize = 1024;
@@ -77,8 +95,8 @@ class String
     template <String::StringNonLinearity non_linearity>
     float ProcessInternal(const float in);
 
-    DelayLine<float, kDelayLineSize>     string_;
-    DelayLine<float, kDelayLineSize / 4> stretch_;
+    DelayLine<float, DELAYLINE_USER_MEMORY, true> string_;
+    DelayLine<float, DELAYLINE_USER_MEMORY, true> stretch_;
 
     float frequency_, non_linearity_amount_, brightness_, damping_;
 
@@ -90,13 +108,18 @@ class String
 
     CrossFade crossfade_;
 
-    float dispersion_noise_;
-    float curved_bridge_;
+    float  dispersion_noise_;
+    float  curved_bridge_;
+    Random rng_;
 
     // Very crappy linear interpolation upsampler used for low pitches that
     // do not fit the delay line. Rarely used.
     float src_phase_;
     float out_sample_[2];
+
+#if !defined(DSY_DELAY_USER_MEMORY)
+    float buffer_[kDelayLineSize + kDelayLineSize / 4];
+#endif
 };
 } // namespace daisysp
 #endif
@@ -20,7 +20,7 @@ void MSM_Pluck::Reinit()
     sicps_ = ((float)npts_ * 256.0f + 128.0f) * (1.0f / sample_rate_);
     /*for(n = npts_; n--;)
     {
-        val   = (float)((float)rand() / (float)RAND_MAX);
+        val   = rng_.NextFloat();
         *ap++ = (val * 2.0f) - 1.0f;
     }*/
     // Make faster
@@ -36,6 +36,7 @@ void MSM_Pluck::Init(float sample_rate, float *buf, int32_t npts, int32_t mode)
     decay_       = 1.0f;
     sample_rate_ = sample_rate;
     mode_        = mode;
+    rng_.Reset();
 
     maxpts_ = npts;
     npts_   = npts;
@@ -51,7 +52,7 @@ void MSM_Pluck::Init(float sample_rate, float *buf, int32_t npts, int32_t mode)
     sicps_ = ((float)npts_ * 256.0f + 128.0f) * (1.0f / sample_rate_);
     for(n = npts_; n--;)
     {
-        val   = (float)((float)rand() / (float)RAND_MAX);
+        val   = rng_.NextFloat();
         *ap++ = (val * 2.0f) - 1.0f;
     }
 
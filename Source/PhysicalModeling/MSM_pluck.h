@@ -4,6 +4,7 @@
 #define DSY_MSM_PLUCK_H
 
 #include <stdint.h>
+#include "Utility/random.h"
 #ifdef __cplusplus
 
 namespace daisysp
@@ -87,6 +88,9 @@ class MSM_Pluck
     */
     inline int32_t GetMode() { return mode_; }
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
     void    Reinit();
     float   amp_, freq_, decay_, damp_, ifreq_;
@@ -97,6 +101,7 @@ class MSM_Pluck
     float   sample_rate_;
     char    init_;
     int32_t mode_;
+    Random  rng_;
 };
 } // namespace daisysp
 #endif
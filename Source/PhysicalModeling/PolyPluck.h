@@ -23,17 +23,37 @@ template <size_t num_voices>
 class PolyPluck
 {
   public:
+    // The voices start from different seeds, see SetSeed()
+    PolyPluck() { SetSeed(Random::kDefaultSeed); }
+
+#if !defined(DSY_DELAY_USER_MEMORY)
     /** Initializes the PolyPluck instance.
         \param sample_rate: rate in Hz that the Process() function will be called.
     */
     void Init(float sample_rate)
     {
-        active_voice_ = 0;
-        p_damp_       = 0.95f;
-        p_decay_      = 0.75f;
+        Init(sample_rate, plkbuff_[0], num_voices * kVoiceSize);
+    }
+#endif
+
+    /** Initializes the PolyPluck instance with user-provided memory,
+        shared evenly between the voices.
+        \param sample_rate: rate in Hz that the Process() function will be called.
+        \param buffer: memory for the voices, must outlive the instance.
+        \param size: length of buffer in samples, see GetBufferSize().
+    */
+    void Init(float sample_rate, float *buffer, size_t size)
+    {
+        const size_t voice_size = size / num_voices;
+        active_voice_           = 0;
+        p_damp_                 = 0.95f;
+        p_decay_                = 0.75f;
         for(size_t i = 0; i < num_voices; i++)
         {
-            plk_[i].Init(sample_rate, plkbuff_[i], 256, PLUCK_MODE_RECURSIVE);
+            plk_[i].Init(sample_rate,
+                         buffer + i * voice_size,
+                         voice_size,
+                         PLUCK_MODE_RECURSIVE);
             plk_[i].SetDamp(0.85f);
             plk_[i].SetAmp(0.18f);
             plk_[i].SetDecay(0.85f);
@@ -41,6 +61,15 @@ class PolyPluck
         blk_.Init(sample_rate);
     }
 
+    /** Returns the memory in samples that gives every voice the same
+        lowest pitch at sample_rate as the built-in memory does at 48kHz.
+    */
+    static size_t GetBufferSize(float sample_rate)
+    {
+        return num_voices
+               * static_cast<size_t>(kVoiceSize * sample_rate / 48000.f + .5f);
+    }
+
     /** Process function, synthesizes and sums the output of all voices,
         triggering a new voice with frequency of MIDI note number when trig > 0.
 
@@ -77,12 +106,25 @@ class PolyPluck
     */
     void SetDecay(float p) { p_damp_ = p; }
 
+    /** Seeds the noise of the voices, see Random::SetSeed() */
+    void SetSeed(uint32_t seed)
+    {
+        for(size_t i = 0; i < num_voices; i++)
+        {
+            plk_[i].SetSeed(seed + i);
+        }
+    }
+
   private:
+    static constexpr size_t kVoiceSize = 256;
+
     DcBlock blk_;
     Pluck   plk_[num_voices];
-    float   plkbuff_[num_voices][256];
     float   p_damp_, p_decay_;
     size_t  active_voice_;
+#if !defined(DSY_DELAY_USER_MEMORY)
+    float plkbuff_[num_voices][kVoiceSize];
+#endif
 };
 
 } // namespace daisysp
@@ -18,17 +18,21 @@ using namespace daisysp;
 
 int Drip::my_random(int max)
 {
-    return (rand() % (max + 1));
+    return (rng_.NextUint() % (max + 1));
 }
 
 float Drip::noise_tick()
 {
-    float temp;
-    temp = 1.0f * rand() - 1073741823.5f;
-    return temp * (1.0f / 1073741823.0f);
+    return rng_.NextBipolar();
 }
 
 void Drip::Init(float sample_rate, float dettack)
+{
+    rng_.Reset();
+    Restart(sample_rate, dettack);
+}
+
+void Drip::Restart(float sample_rate, float dettack)
 {
     sample_rate_ = sample_rate;
     float temp;
@@ -83,11 +87,11 @@ float Drip::Process(bool trig)
     float data;
     float lastOutput;
 
-    float tpidsr = 2.0f * PI_F / sample_rate_;
+    float inv_sr = 1.0f / sample_rate_;
 
     if(trig)
     {
-        Init(sample_rate_, dettack_);
+        Restart(sample_rate_, dettack_);
     }
     if(num_tubes_ != 0.0f && num_tubes_ != num_objects_)
     {
@@ -100,7 +104,7 @@ float Drip::Process(bool trig)
     if(freq_ != 0.0f && freq_ != res_freq0_)
     {
         res_freq0_ = freq_;
-        coeffs00_  = -WUTR_RESON * 2.0f * cosf(res_freq0_ * tpidsr);
+        coeffs00_  = -WUTR_RESON * 2.0f * LutCos(res_freq0_ * inv_sr);
     }
     if(damp_ != 0.0f && damp_ != shake_damp_)
     {
@@ -117,12 +121,12 @@ float Drip::Process(bool trig)
     if(freq1_ != 0.0f && freq1_ != res_freq1_)
     {
         res_freq1_ = freq1_;
-        coeffs10_  = -WUTR_RESON * 2.0f * cosf(res_freq1_ * tpidsr);
+        coeffs10_  = -WUTR_RESON * 2.0f * LutCos(res_freq1_ * inv_sr);
     }
     if(freq2_ != 0.0f && freq2_ != res_freq2_)
     {
         res_freq2_ = freq2_;
-        coeffs20_  = -WUTR_RESON * 2.0f * cosf(res_freq2_ * tpidsr);
+        coeffs20_  = -WUTR_RESON * 2.0f * LutCos(res_freq2_ * inv_sr);
     }
     if((--kloop_) == 0.0f)
     {
@@ -164,19 +168,19 @@ float Drip::Process(bool trig)
     if(gains0_ > 0.001f)
     {
         center_freqs0_ *= WUTR_FREQ_SWEEP;
-        coeffs00_ = -WUTR_RESON * 2.0f * cosf(center_freqs0_ * tpidsr);
+        coeffs00_ = -WUTR_RESON * 2.0f * LutCos(center_freqs0_ * inv_sr);
     }
     gains1_ *= WUTR_RESON;
     if(gains1_ > 0.00f)
     {
         center_freqs1_ *= WUTR_FREQ_SWEEP;
-        coeffs10_ = -WUTR_RESON * 2.0f * cosf(center_freqs1_ * tpidsr);
+        coeffs10_ = -WUTR_RESON * 2.0f * LutCos(center_freqs1_ * inv_sr);
     }
     gains2_ *= WUTR_RESON;
     if(gains2_ > 0.001f)
     {
         center_freqs2_ *= WUTR_FREQ_SWEEP;
-        coeffs20_ = -WUTR_RESON * 2.0f * cosf(center_freqs2_ * tpidsr);
+        coeffs20_ = -WUTR_RESON * 2.0f * LutCos(center_freqs2_ * inv_sr);
     }
 
     sndLevel *= soundDecay;
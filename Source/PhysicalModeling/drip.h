@@ -3,6 +3,7 @@
 #define DSY_DRIP_H
 
 #include <stdint.h>
+#include "Utility/random.h"
 #ifdef __cplusplus
 
 /**  @file drip.h */
@@ -35,6 +36,9 @@ class Drip
     */
     float Process(bool trig);
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
     float gains0_, gains1_, gains2_, kloop_, dettack_, num_tubes_, damp_,
         shake_max_, freq_, freq1_, freq2_, amp_, snd_level_, outputs00_,
@@ -45,6 +49,11 @@ class Drip
         coeffs20_, shake_energy_, shake_damp_, shake_max_save_, num_objects_,
         sample_rate_, res_freq0_, res_freq1_, res_freq2_, inputs1_, inputs2_;
 
+    Random rng_;
+
+    // Everything Init() sets but the noise, also reset on every drip
+    void Restart(float sample_rate, float dettack);
+
     int   my_random(int max);
     float noise_tick();
 };
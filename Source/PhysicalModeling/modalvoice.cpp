@@ -24,6 +24,7 @@ void ModalVoice::Init(float sample_rate)
 void ModalVoice::SetSustain(bool sustain)
 {
     sustain_ = sustain;
+    dirty_   = true;
 }
 
 void ModalVoice::Trig()
@@ -36,11 +37,14 @@ void ModalVoice::SetFreq(float freq)
     resonator_.SetFreq(freq);
     f0_ = freq / sample_rate_;
     f0_ = fclamp(f0_, 0.f, .25f);
+
+    dirty_ = true;
 }
 
 void ModalVoice::SetAccent(float accent)
 {
     accent_ = fclamp(accent, 0.f, 1.f);
+    dirty_  = true;
 }
 
 void ModalVoice::SetStructure(float structure)
@@ -52,11 +56,13 @@ void ModalVoice::SetBrightness(float brightness)
 {
     brightness_ = fclamp(brightness, 0.f, 1.f);
     density_    = brightness_ * brightness_;
+    dirty_      = true;
 }
 
 void ModalVoice::SetDamping(float damping)
 {
     damping_ = fclamp(damping, 0.f, 1.f);
+    dirty_   = true;
 }
 
 float ModalVoice::GetAux()
@@ -64,7 +70,7 @@ float ModalVoice::GetAux()
     return aux_;
 }
 
-float ModalVoice::Process(bool trigger)
+void ModalVoice::Update()
 {
     float brightness = brightness_ + 0.25f * accent_ * (1.0f - brightness_);
     float damping    = damping_ + 0.25f * accent_ * (1.0f - damping_);
@@ -79,31 +85,88 @@ float ModalVoice::Process(bool trigger)
         0.499f);
     const float q = sustain_ ? 0.7f : 1.5f;
 
+    const float dust_f = 0.00005f + 0.99995f * density_ * density_;
+    dust_.SetDensity(dust_f);
+    dust_gain_ = 4.0f - dust_f * 3.0f;
+
+    const float attenuation = 1.0f - damping * 0.5f;
+    const float amplitude   = (0.12f + 0.08f * accent_) * attenuation;
+    strike_ = amplitude * powf(2.f, kOneTwelfth * (cutoff * cutoff * 24.0f))
+              / cutoff;
+
+    cutoff_ = cutoff;
+    excitation_filter_.SetCoefficients(&cutoff_, &q);
+
+    resonator_.SetBrightness(brightness);
+    resonator_.SetDamping(damping);
+    dirty_ = false;
+}
+
+float ModalVoice::Process(bool trigger)
+{
+    if(dirty_)
+    {
+        Update();
+    }
+
     float temp = 0.f;
     // Synthesize excitation signal.
     if(sustain_)
     {
-        const float dust_f = 0.00005f + 0.99995f * density_ * density_;
-        dust_.SetDensity(dust_f);
-        temp = dust_.Process() * (4.0f - dust_f * 3.0f) * accent_;
+        temp = dust_.Process() * dust_gain_ * accent_;
     }
     else if(trigger || trig_)
     {
-        const float attenuation = 1.0f - damping * 0.5f;
-        const float amplitude   = (0.12f + 0.08f * accent_) * attenuation;
-        temp = amplitude * powf(2.f, kOneTwelfth * (cutoff * cutoff * 24.0f))
-               / cutoff;
+        temp  = strike_;
         trig_ = false;
     }
 
     const float one = 1.0f;
-    excitation_filter_.Process<ResonatorSvf<1>::LOW_PASS, false>(
-        &cutoff, &q, &one, temp, &temp);
+    excitation_filter_.ProcessBlock<ResonatorSvf<1>::LOW_PASS, false>(
+        &one, &temp, &temp, 1);
 
     aux_ = temp;
 
-    resonator_.SetBrightness(brightness);
-    resonator_.SetDamping(damping);
-
     return resonator_.Process(temp);
-}
\ No newline at end of file
+}
+
+void ModalVoice::Render(bool trigger, float *out, size_t size)
+{
+    const float one = 1.0f;
+    float       excitation[kBlockChunk];
+    while(size > 0)
+    {
+        if(dirty_)
+        {
+            Update();
+        }
+
+        const size_t todo = size < kBlockChunk ? size : kBlockChunk;
+        if(sustain_)
+        {
+            dust_.Render(excitation, todo);
+            for(size_t i = 0; i < todo; i++)
+            {
+                excitation[i] = excitation[i] * dust_gain_ * accent_;
+            }
+        }
+        else
+        {
+            std::fill(excitation, excitation + todo, 0.f);
+            if(trigger || trig_)
+            {
+                excitation[0] = strike_;
+                trig_         = false;
+            }
+        }
+        trigger = false;
+
+        excitation_filter_.ProcessBlock<ResonatorSvf<1>::LOW_PASS, false>(
+            &one, excitation, excitation, todo);
+        aux_ = excitation[todo - 1];
+
+        resonator_.ProcessBlock(excitation, out, todo);
+        out += todo;
+        size -= todo;
+    }
+}
@@ -38,6 +38,14 @@ class ModalVoice
     */
     float Process(bool trigger = false);
 
+    /** Renders a block, same as calling Process() size times with the
+        trigger on the first sample only
+        \param trigger - strike the resonator at the start of the block
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(bool trigger, float *out, size_t size);
+
     /** Continually excite the resonator with noise.
         \param sustain True turns on the noise.
     */
@@ -74,14 +82,25 @@ class ModalVoice
     /** Get the raw excitation signal. Must call Process() first. */
     float GetAux();
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { dust_.SetSeed(seed); }
+
   private:
+    static constexpr size_t kBlockChunk = 48;
+
+    // Recomputes the values below from the parameters
+    void Update();
+
     float sample_rate_;
 
-    bool  sustain_, trig_;
+    bool  sustain_, trig_, dirty_;
     float f0_, structure_, brightness_, damping_;
     float density_, accent_;
     float aux_;
 
+    // Derived from the parameters, valid while dirty_ is false
+    float cutoff_, strike_, dust_gain_;
+
     ResonatorSvf<1> excitation_filter_;
     Resonator       resonator_;
     Dust            dust_;
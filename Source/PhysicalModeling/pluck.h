@@ -4,6 +4,7 @@
 #define DSY_PLUCK_H
 
 #include <stdint.h>
+#include "Utility/random.h"
 #ifdef __cplusplus
 
 namespace daisysp
@@ -85,6 +86,9 @@ class Pluck
     */
     inline int32_t GetMode() { return mode_; }
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
     void    Reinit();
     float   amp_, freq_, decay_, damp_, ifreq_;
@@ -94,6 +98,7 @@ class Pluck
     float   sample_rate_;
     char    init_;
     int32_t mode_;
+    Random  rng_;
 };
 } // namespace daisysp
 #endif
@@ -14,7 +14,7 @@ void Resonator::Init(float position, int resolution, float sample_rate)
 
     resolution_ = fmin(resolution, kMaxNumModes);
 
-    for(int i = 0; i < resolution; ++i)
+    for(int i = 0; i < resolution_; ++i)
     {
         mode_amplitude_[i] = cos(position * TWOPI_F) * 0.25f;
     }
@@ -23,6 +23,7 @@ void Resonator::Init(float position, int resolution, float sample_rate)
     {
         mode_filters_[i].Init();
     }
+    dirty_ = true;
 }
 
 inline float NthHarmonicCompensation(int n, float stiffness)
@@ -45,9 +46,38 @@ inline float NthHarmonicCompensation(int n, float stiffness)
 
 float Resonator::Process(const float in)
 {
-    //convert Hz to cycles / sample
     float out = 0.f;
+    ProcessBlock(&in, &out, 1);
+    return out;
+}
+
+void Resonator::ProcessBlock(const float* in, float* out, size_t size)
+{
+    if(dirty_)
+    {
+        UpdateModes();
+    }
+
+    // All batches run for each sample, their recursions are independent
+    // and overlap, a single batch over the whole block would wait on its
+    // own results.
+    const int num_batches = resolution_ / kModeBatchSize;
+    for(size_t n = 0; n < size; ++n)
+    {
+        float s_out = 0.f;
+        for(int i = 0; i < num_batches; ++i)
+        {
+            mode_filters_[i]
+                .ProcessBlock<ResonatorSvf<kModeBatchSize>::BAND_PASS, true>(
+                    &mode_gain_[i * kModeBatchSize], &in[n], &s_out, 1);
+        }
+        out[n] = s_out;
+    }
+}
 
+void Resonator::UpdateModes()
+{
+    //convert Hz to cycles / sample
     float stiffness  = CalcStiff(structure_);
     float f0         = frequency_ * NthHarmonicCompensation(3, stiffness);
     float brightness = brightness_;
@@ -65,7 +95,6 @@ float Resonator::Process(const float in)
 
     float mode_q[kModeBatchSize];
     float mode_f[kModeBatchSize];
-    float mode_a[kModeBatchSize];
     int   batch_counter = 0;
 
     ResonatorSvf<kModeBatchSize>* batch_processor = &mode_filters_[0];
@@ -81,15 +110,13 @@ float Resonator::Process(const float in)
 
         mode_f[batch_counter] = mode_frequency;
         mode_q[batch_counter] = 1.0f + mode_frequency * q;
-        mode_a[batch_counter] = mode_amplitude_[i] * mode_attenuation;
+        mode_gain_[i]         = mode_amplitude_[i] * mode_attenuation;
         ++batch_counter;
 
         if(batch_counter == kModeBatchSize)
         {
             batch_counter = 0;
-            batch_processor
-                ->Process<ResonatorSvf<kModeBatchSize>::BAND_PASS, true>(
-                    mode_f, mode_q, mode_a, in, &out);
+            batch_processor->SetCoefficients(mode_f, mode_q);
             ++batch_processor;
         }
 
@@ -107,28 +134,47 @@ float Resonator::Process(const float in)
         harmonic += f0;
         q *= q_loss;
     }
-
-    return out;
+    dirty_ = false;
 }
 
 void Resonator::SetFreq(float freq)
 {
-    frequency_ = freq / sample_rate_;
+    freq /= sample_rate_;
+    if(freq != frequency_)
+    {
+        frequency_ = freq;
+        dirty_     = true;
+    }
 }
 
 void Resonator::SetStructure(float structure)
 {
-    structure_ = fmax(fmin(structure, 1.f), 0.f);
+    structure = fmax(fmin(structure, 1.f), 0.f);
+    if(structure != structure_)
+    {
+        structure_ = structure;
+        dirty_     = true;
+    }
 }
 
 void Resonator::SetBrightness(float brightness)
 {
-    brightness_ = fmax(fmin(brightness, 1.f), 0.f);
+    brightness = fmax(fmin(brightness, 1.f), 0.f);
+    if(brightness != brightness_)
+    {
+        brightness_ = brightness;
+        dirty_      = true;
+    }
 }
 
 void Resonator::SetDamping(float damping)
 {
-    damping_ = fmax(fmin(damping, 1.f), 0.f);
+    damping = fmax(fmin(damping, 1.f), 0.f);
+    if(damping != damping_)
+    {
+        damping_ = damping;
+        dirty_   = true;
+    }
 }
 
 float Resonator::CalcStiff(float sig)
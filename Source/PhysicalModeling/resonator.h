@@ -98,6 +98,76 @@ class ResonatorSvf
         }
     }
 
+    /** Computes the coefficients used by ProcessBlock(), so they can be
+        kept for as long as f and q do not change
+    */
+    void SetCoefficients(const float* f, const float* q)
+    {
+        for(int i = 0; i < batch_size; ++i)
+        {
+            const float r = 1.0f / q[i];
+            g_[i]         = fasttan(f[i]);
+            h_[i]         = 1.0f / (1.0f + r * g_[i] + g_[i] * g_[i]);
+            r_plus_g_[i]  = r + g_[i];
+        }
+    }
+
+    /** Same as Process(), for a block of input, with the coefficients from
+        the last SetCoefficients()
+    */
+    template <FilterMode mode, bool add>
+    void ProcessBlock(const float* gain,
+                      const float* in,
+                      float*       out,
+                      size_t       size)
+    {
+        float g[batch_size];
+        float r_plus_g[batch_size];
+        float h[batch_size];
+        float state_1[batch_size];
+        float state_2[batch_size];
+        float gains[batch_size];
+        for(int i = 0; i < batch_size; ++i)
+        {
+            g[i]        = g_[i];
+            r_plus_g[i] = r_plus_g_[i];
+            h[i]        = h_[i];
+            state_1[i]  = state_1_[i];
+            state_2[i]  = state_2_[i];
+            gains[i]    = gain[i];
+        }
+
+        for(size_t n = 0; n < size; ++n)
+        {
+            float s_in  = in[n];
+            float s_out = 0.0f;
+            for(int i = 0; i < batch_size; ++i)
+            {
+                const float hp
+                    = (s_in - r_plus_g[i] * state_1[i] - state_2[i]) * h[i];
+                const float bp = g[i] * hp + state_1[i];
+                state_1[i]     = g[i] * hp + bp;
+                const float lp = g[i] * bp + state_2[i];
+                state_2[i]     = g[i] * bp + lp;
+                s_out += gains[i] * ((mode == LOW_PASS) ? lp : bp);
+            }
+            if(add)
+            {
+                out[n] += s_out;
+            }
+            else
+            {
+                out[n] = s_out;
+            }
+        }
+
+        for(int i = 0; i < batch_size; ++i)
+        {
+            state_1_[i] = state_1[i];
+            state_2_[i] = state_2[i];
+        }
+    }
+
   private:
     static constexpr float kPiPow3 = PI_F * PI_F * PI_F;
     static constexpr float kPiPow5 = kPiPow3 * PI_F * PI_F;
@@ -111,6 +181,9 @@ class ResonatorSvf
 
     float state_1_[batch_size];
     float state_2_[batch_size];
+    float g_[batch_size];
+    float r_plus_g_[batch_size];
+    float h_[batch_size];
 };
 
 
@@ -118,6 +191,8 @@ class ResonatorSvf
        @brief Resonant Body Simulation
        @author Ported by Ben Sergentanis 
        @date Jan 2021 
+       The mode frequencies and filter coefficients are only recomputed
+       after a setter changed a value, not on every sample. \n
        Ported from pichenettes/eurorack/plaits/dsp/physical_modelling/resonator.h \n
        to an independent module. \n
        Original code written by Emilie Gillet in 2016. \n 
@@ -140,6 +215,13 @@ class Resonator
     */
     float Process(const float in);
 
+    /** Process a block of the input signal
+        \param in - excitation signal, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float* in, float* out, size_t size);
+
     /** Resonator frequency.
         \param freq Frequency in Hz.
     */
@@ -171,10 +253,13 @@ class Resonator
     static constexpr float stiff_frac_2   = 1.f / .6f;
 
     float sample_rate_;
+    bool  dirty_;
 
     float CalcStiff(float sig);
+    void  UpdateModes();
 
     float                        mode_amplitude_[kMaxNumModes];
+    float                        mode_gain_[kMaxNumModes];
     ResonatorSvf<kModeBatchSize> mode_filters_[kMaxNumModes / kModeBatchSize];
 };
 
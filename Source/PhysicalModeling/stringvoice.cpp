@@ -4,12 +4,26 @@
 
 using namespace daisysp;
 
+#if !defined(DSY_DELAY_USER_MEMORY)
 void StringVoice::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
-
-    excitation_filter_.Init(sample_rate);
     string_.Init(sample_rate_);
+    InitVoice();
+}
+#endif
+
+void StringVoice::Init(float sample_rate, float *buffer, size_t size)
+{
+    sample_rate_ = sample_rate;
+    string_.Init(sample_rate_, buffer, size);
+    InitVoice();
+}
+
+void StringVoice::InitVoice()
+{
+    rng_.Reset();
+    excitation_filter_.Init(sample_rate_);
     dust_.Init();
     remaining_noise_samples_ = 0;
 
@@ -107,7 +121,7 @@ float StringVoice::Process(bool trigger)
     }
     else if(remaining_noise_samples_)
     {
-        temp = 2.0f * rand() * kRandFrac - 1.0f;
+        temp = rng_.NextBipolar();
         remaining_noise_samples_--;
         remaining_noise_samples_ = DSY_MAX(remaining_noise_samples_, 0.f);
     }
@@ -122,3 +136,11 @@ float StringVoice::Process(bool trigger)
 
     return string_.Process(temp);
 }
+
+void StringVoice::Render(bool trigger, float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process(trigger && i == 0);
+    }
+}
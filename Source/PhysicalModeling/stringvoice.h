@@ -24,13 +24,29 @@ namespace daisysp
 class StringVoice
 {
   public:
-    StringVoice() {}
+    // The noise sources start from different seeds, see SetSeed()
+    StringVoice() { SetSeed(Random::kDefaultSeed); }
     ~StringVoice() {}
 
+#if !defined(DSY_DELAY_USER_MEMORY)
     /** Initialize the module
         \param sample_rate Audio engine sample rate
     */
     void Init(float sample_rate);
+#endif
+
+    /** Initialize the module with user-provided string memory
+        \param sample_rate Audio engine sample rate
+        \param buffer String delay memory, must outlive the voice.
+        \param size Length of buffer in samples, see GetBufferSize().
+    */
+    void Init(float sample_rate, float *buffer, size_t size);
+
+    /** Returns the string memory in samples needed at sample_rate */
+    static size_t GetBufferSize(float sample_rate)
+    {
+        return String::GetBufferSize(sample_rate);
+    }
 
     /** Reset the string oscillator */
     void Reset();
@@ -40,6 +56,14 @@ class StringVoice
     */
     float Process(bool trigger = false);
 
+    /** Renders a block, same as calling Process() size times with the
+        trigger on the first sample only
+        \param trigger - strike the string at the start of the block
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(bool trigger, float *out, size_t size);
+
     /** Continually excite the string with noise.
         \param sustain True turns on the noise.
     */
@@ -76,6 +100,14 @@ class StringVoice
     /** Get the raw excitation signal. Must call Process() first. */
     float GetAux();
 
+    /** Seeds the noise sources, see Random::SetSeed() */
+    void SetSeed(uint32_t seed)
+    {
+        rng_.SetSeed(seed);
+        dust_.SetSeed(seed + 1);
+        string_.SetSeed(seed + 2);
+    }
+
   private:
     float sample_rate_;
 
@@ -88,6 +120,9 @@ class StringVoice
     Svf    excitation_filter_;
     String string_;
     size_t remaining_noise_samples_;
+    Random rng_;
+
+    void InitVoice();
 };
 } // namespace daisysp
 #endif
@@ -138,3 +138,26 @@ float BlOsc::Process()
 
     return 0.0;
 }
+
+void BlOsc::Render(float *out, size_t size)
+{
+    switch(mode_)
+    {
+        case WAVE_TRIANGLE:
+            for(size_t i = 0; i < size; i++)
+                out[i] = ProcessTriangle();
+            break;
+        case WAVE_SAW:
+            for(size_t i = 0; i < size; i++)
+                out[i] = ProcessSaw();
+            break;
+        case WAVE_SQUARE:
+            for(size_t i = 0; i < size; i++)
+                out[i] = ProcessSquare();
+            break;
+        default:
+            for(size_t i = 0; i < size; i++)
+                out[i] = 0.f;
+            break;
+    }
+}
@@ -3,6 +3,7 @@
 #define DSY_BLOSC_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -41,6 +42,12 @@ class BlOsc
     */
     float Process();
 
+    /** Renders a block of samples, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float *out, size_t size);
+
 
     /** - Float freq: Set oscillator frequency in Hz.
     */
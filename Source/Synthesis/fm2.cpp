@@ -63,3 +63,11 @@ void Fm2::Reset()
     car_.Reset();
     mod_.Reset();
 }
+
+void Fm2::Render(float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process();
+    }
+}
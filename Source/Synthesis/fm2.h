@@ -3,6 +3,7 @@
 #define DSY_FM2_H
 
 #include <stdint.h>
+#include <stddef.h>
 #include "Synthesis/oscillator.h"
 #ifdef __cplusplus
 
@@ -31,6 +32,12 @@ class Fm2
     */
     float Process();
 
+    /** Renders a block of samples, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float *out, size_t size);
+
     /** Carrier freq. setter
         \param freq Carrier frequency in Hz
     */
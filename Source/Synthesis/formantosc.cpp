@@ -94,3 +94,11 @@ inline float FormantOscillator::NextBlepSample(float t)
     t = 1.0f - t;
     return -0.5f * t * t;
 }
+
+void FormantOscillator::Render(float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process();
+    }
+}
@@ -3,6 +3,7 @@
 #define DSY_FORMANTOSCILLATOR_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 /** @file formantosc.h */
@@ -33,6 +34,12 @@ class FormantOscillator
     */
     float Process();
 
+    /** Renders a block of samples, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float *out, size_t size);
+
     /** Set the formant frequency.
         \param freq Frequency in Hz
     */
@@ -3,6 +3,7 @@
 #define DSY_HARMONIC_H
 
 #include <stdint.h>
+#include <stddef.h>
 #include "Utility/dsp.h"
 #ifdef __cplusplus
 
@@ -99,6 +100,18 @@ class HarmonicOscillator
         return sum;
     }
 
+    /** Renders a block of samples, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float* out, size_t size)
+    {
+        for(size_t i = 0; i < size; i++)
+        {
+            out[i] = Process();
+        }
+    }
+
     /** Set the main frequency 
         \param freq Freq to be set in Hz.
     */
@@ -61,6 +61,165 @@ float Oscillator::Process()
     return out * amp_;
 }
 
+template <uint8_t waveform, bool modulated>
+void Oscillator::RenderWaveform(const float *freq,
+                                float *      out,
+                                size_t       size,
+                                float        phase_inc_step,
+                                float        amp_step)
+{
+    const float sr_recip  = sr_recip_;
+    float       phase_inc = phase_inc_;
+    float       amp       = amp_;
+    float       phase     = phase_;
+    float       last_out  = last_out_;
+    bool        eoc = false, eor = false;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        if(modulated)
+        {
+            phase_inc = (TWOPI_F * freq[i]) * sr_recip;
+        }
+        else
+        {
+            phase_inc += phase_inc_step;
+        }
+        amp += amp_step;
+
+        float s, t;
+        switch(waveform)
+        {
+            case WAVE_SIN: s = sinf(phase); break;
+            case WAVE_TRI:
+                t = -1.0f + (2.0f * phase * TWO_PI_RECIP);
+                s = 2.0f * (fabsf(t) - 0.5f);
+                break;
+            case WAVE_SAW:
+                s = -1.0f * (((phase * TWO_PI_RECIP * 2.0f)) - 1.0f);
+                break;
+            case WAVE_RAMP: s = ((phase * TWO_PI_RECIP * 2.0f)) - 1.0f; break;
+            case WAVE_SQUARE: s = phase < PI_F ? (1.0f) : -1.0f; break;
+            case WAVE_POLYBLEP_TRI:
+                t = phase * TWO_PI_RECIP;
+                s = phase < PI_F ? 1.0f : -1.0f;
+                s += Polyblep(phase_inc, t);
+                s -= Polyblep(phase_inc, fmodf(t + 0.5f, 1.0f));
+                s        = phase_inc * s + (1.0f - phase_inc) * last_out;
+                last_out = s;
+                break;
+            case WAVE_POLYBLEP_SAW:
+                t = phase * TWO_PI_RECIP;
+                s = (2.0f * t) - 1.0f;
+                s -= Polyblep(phase_inc, t);
+                s *= -1.0f;
+                break;
+            case WAVE_POLYBLEP_SQUARE:
+                t = phase * TWO_PI_RECIP;
+                s = phase < PI_F ? 1.0f : -1.0f;
+                s += Polyblep(phase_inc, t);
+                s -= Polyblep(phase_inc, fmodf(t + 0.5f, 1.0f));
+                s *= 0.707f;
+                break;
+            default: s = 0.0f; break;
+        }
+        phase += phase_inc;
+        if(phase > TWOPI_F)
+        {
+            phase -= TWOPI_F;
+            eoc = true;
+        }
+        eor = eor || (phase - phase_inc < PI_F && phase >= PI_F);
+        out[i] = s * amp;
+    }
+
+    phase_     = phase;
+    phase_inc_ = phase_inc;
+    amp_       = amp;
+    last_out_  = last_out;
+    eoc_       = eoc;
+    eor_       = eor;
+}
+
+template <bool modulated>
+void Oscillator::RenderBlock(const float *freq,
+                             float *      out,
+                             size_t       size,
+                             float        phase_inc_step,
+                             float        amp_step)
+{
+    switch(waveform_)
+    {
+        case WAVE_SIN:
+            RenderWaveform<WAVE_SIN, modulated>(
+                freq, out, size, phase_inc_step, amp_step);
+            break;
+        case WAVE_TRI:
+            RenderWaveform<WAVE_TRI, modulated>(
+                freq, out, size, phase_inc_step, amp_step);
+            break;
+        case WAVE_SAW:
+            RenderWaveform<WAVE_SAW, modulated>(
+                freq, out, size, phase_inc_step, amp_step);
+            break;
+        case WAVE_RAMP:
+            RenderWaveform<WAVE_RAMP, modulated>(
+                freq, out, size, phase_inc_step, amp_step);
+            break;
+        case WAVE_SQUARE:
+            RenderWaveform<WAVE_SQUARE, modulated>(
+                freq, out, size, phase_inc_step, amp_step);
+            break;
+        case WAVE_POLYBLEP_TRI:
+            RenderWaveform<WAVE_POLYBLEP_TRI, modulated>(
+                freq, out, size, phase_inc_step, amp_step);
+            break;
+        case WAVE_POLYBLEP_SAW:
+            RenderWaveform<WAVE_POLYBLEP_SAW, modulated>(
+                freq, out, size, phase_inc_step, amp_step);
+            break;
+        case WAVE_POLYBLEP_SQUARE:
+            RenderWaveform<WAVE_POLYBLEP_SQUARE, modulated>(
+                freq, out, size, phase_inc_step, amp_step);
+            break;
+        default:
+            RenderWaveform<WAVE_LAST, modulated>(
+                freq, out, size, phase_inc_step, amp_step);
+            break;
+    }
+}
+
+void Oscillator::Render(float *out, size_t size)
+{
+    RenderBlock<false>(nullptr, out, size, 0.0f, 0.0f);
+}
+
+void Oscillator::Render(float *out, size_t size, float freq, float amp)
+{
+    if(size == 0)
+        return;
+    const float phase_inc = CalcPhaseInc(freq);
+    const float scale     = 1.0f / static_cast<float>(size);
+    RenderBlock<false>(nullptr,
+                       out,
+                       size,
+                       (phase_inc - phase_inc_) * scale,
+                       (amp - amp_) * scale);
+    // land exactly on the targets, not on the accumulated steps
+    freq_      = freq;
+    phase_inc_ = phase_inc;
+    amp_       = amp;
+}
+
+void Oscillator::Render(const float *freq, float *out, size_t size)
+{
+    if(size == 0)
+        return;
+    // read first, out may overwrite freq
+    freq_ = freq[size - 1];
+    RenderBlock<true>(freq, out, size, 0.0f, 0.0f);
+}
+
 float Oscillator::CalcPhaseInc(float f)
 {
     return (TWOPI_F * f) * sr_recip_;
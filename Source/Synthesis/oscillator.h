@@ -2,6 +2,7 @@
 #ifndef DSY_OSCILLATOR_H
 #define DSY_OSCILLATOR_H
 #include <stdint.h>
+#include <stddef.h>
 #include "Utility/dsp.h"
 #ifdef __cplusplus
 
@@ -47,6 +48,7 @@ class Oscillator
         amp_       = 0.5f;
         phase_     = 0.0f;
         phase_inc_ = CalcPhaseInc(freq_);
+        last_out_  = 0.0f;
         waveform_  = WAVE_SIN;
         eoc_       = true;
         eor_       = true;
@@ -92,6 +94,33 @@ class Oscillator
     */
     float Process();
 
+    /** Renders a block of the waveform, equivalent to calling Process() size times.
+        After the call IsEOC() and IsEOR() report whether a cycle ended or a rise
+        ended anywhere within the block.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float *out, size_t size);
+
+    /** Renders a block while frequency and amplitude glide linearly from
+        their current values to the given ones, without the zipper noise
+        of calling SetFreq() and SetAmp() once per block.
+        \param out - output buffer
+        \param size - number of samples to render
+        \param freq - frequency in Hz at the end of the block
+        \param amp - amplitude at the end of the block
+    */
+    void Render(float *out, size_t size, float freq, float amp);
+
+    /** Renders a block with a frequency for every sample, for FM or
+        modulation computed at audio rate. SetFreq() is not needed, the
+        oscillator keeps the last frequency of the block.
+        \param freq - frequency buffer in Hz
+        \param out - output buffer, may be the same as freq
+        \param size - number of samples to render
+    */
+    void Render(const float *freq, float *out, size_t size);
+
 
     /** Adds a value 0.0-1.0 (mapped to 0.0-TWO_PI) to the current phase. Useful for PM and "FM" synthesis.
     */
@@ -101,7 +130,21 @@ class Oscillator
     void Reset(float _phase = 0.0f) { phase_ = _phase; }
 
   private:
-    float   CalcPhaseInc(float f);
+    float CalcPhaseInc(float f);
+    template <bool modulated>
+    void RenderBlock(const float *freq,
+                     float *      out,
+                     size_t       size,
+                     float        phase_inc_step,
+                     float        amp_step);
+    template <uint8_t waveform, bool modulated>
+    void RenderWaveform(const float *freq,
+                        float *      out,
+                        size_t       size,
+                        float        phase_inc_step,
+                        float        amp_step);
+
+
     uint8_t waveform_;
     float   amp_, freq_;
     float   sr_, sr_recip_, phase_, phase_inc_;
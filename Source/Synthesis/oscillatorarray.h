@@ -0,0 +1,404 @@
+#pragma once
+#ifndef DSY_OSCILLATORARRAY_H
+#define DSY_OSCILLATORARRAY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "Utility/dsp.h"
+#include "Utility/simd.h"
+#include "Synthesis/oscillator.h"
+#ifdef __cplusplus
+
+/** @file oscillatorarray.h */
+
+namespace daisysp
+{
+/** Array of num_voices independent oscillators, e.g. for unison or chords.
+
+    Each voice has its own frequency, amplitude and waveform, taken from
+    the Oscillator::WAVE_ choices. Phases and parameters are stored
+    structure-of-arrays style so that 4 or 8 voices are rendered at once
+    with SSE/AVX/NEON, see Utility/simd.h.
+
+    The waveforms follow Oscillator closely but not exactly:
+    - WAVE_SIN uses simd::Sin2Pi() instead of sinf().
+    - WAVE_POLYBLEP_SAW and WAVE_POLYBLEP_SQUARE use the two sample BLEPs
+      of dsp.h (ThisBlepSample()/NextBlepSample()), which spread each jump
+      over the samples before and after it the way Oscillator's polyBLEP
+      does. Only the first sample after Init() or Reset() differs.
+    - WAVE_POLYBLEP_TRI is Oscillator's: a polyBLEP square through a leaky
+      integrator, so like there it is not a full scale triangle.
+    - WAVE_SAW, WAVE_RAMP and WAVE_SQUARE can jump one sample apart from
+      Oscillator, whose phase is kept in radians.
+
+    Lanes with different waveforms may share a vector; each vector renders
+    only the waveforms present in it, so the cost is lowest when voices
+    with the same waveform are grouped.
+
+    This is unrelated to OscillatorBank, the divide-down organ oscillator.
+
+    \param num_voices - number of oscillators in the array, a multiple of 4.
+*/
+template <size_t num_voices>
+class OscillatorArray
+{
+  public:
+    static_assert(num_voices > 0 && num_voices % 4 == 0,
+                  "OscillatorArray: number of voices must be a multiple of 4");
+
+    OscillatorArray() {}
+    ~OscillatorArray() {}
+
+    /** Initializes all oscillators
+        \param sample_rate - sample rate of the audio engine being run.
+
+        Defaults, as for Oscillator:
+        - freq = 100 Hz
+        - amp = 0.5
+        - waveform = sine wave
+        - phase = 0
+    */
+    void Init(float sample_rate)
+    {
+        sr_recip_ = 1.0f / sample_rate;
+        for(size_t v = 0; v < num_voices; v++)
+            tri_[v] = 0.0f;
+        for(uint8_t w = 0; w < Oscillator::WAVE_LAST; w++)
+        {
+            for(size_t v = 0; v < num_voices; v++)
+                weight_[w][v] = 0.0f;
+        }
+        for(size_t v = 0; v < num_voices; v++)
+        {
+            phase_[v] = 0.0f;
+            next_[v]  = 0.0f;
+            amp_[v]   = 0.5f;
+            SetFreq(v, 100.0f);
+            SetWaveform(v, Oscillator::WAVE_SIN);
+        }
+    }
+
+    /** Sets the frequency of one voice.
+        \param voice - voice index, 0 to num_voices - 1
+        \param f - frequency in Hz, between 0 and sample_rate / 2
+    */
+    void SetFreq(size_t voice, float f)
+    {
+        const float inc   = fclamp(f * sr_recip_, 0.0f, 0.499f);
+        inc_[voice]       = inc;
+        inc_recip_[voice] = 1.0f / DSY_MAX(inc, 1.0e-6f);
+    }
+
+    /** Sets the frequency of all voices. */
+    void SetFreq(float f)
+    {
+        for(size_t v = 0; v < num_voices; v++)
+            SetFreq(v, f);
+    }
+
+    /** Sets the amplitude of one voice.
+        \param voice - voice index, 0 to num_voices - 1
+        \param a - amplitude
+    */
+    void SetAmp(size_t voice, float a) { amp_[voice] = a; }
+
+    /** Sets the amplitude of all voices. */
+    void SetAmp(float a)
+    {
+        for(size_t v = 0; v < num_voices; v++)
+            amp_[v] = a;
+    }
+
+    /** Sets the waveform of one voice.
+        \param voice - voice index, 0 to num_voices - 1
+        \param wf - one of Oscillator::WAVE_, sine if out of range
+    */
+    void SetWaveform(size_t voice, uint8_t wf)
+    {
+        wf = wf < Oscillator::WAVE_LAST
+                 ? wf
+                 : static_cast<uint8_t>(Oscillator::WAVE_SIN);
+        for(uint8_t w = 0; w < Oscillator::WAVE_LAST; w++)
+        {
+            weight_[w][voice] = w == wf ? 1.0f : 0.0f;
+        }
+        switch(wf)
+        {
+            case Oscillator::WAVE_POLYBLEP_SAW:
+                blep_gain_[voice] = 1.0f;
+                break;
+            case Oscillator::WAVE_POLYBLEP_SQUARE:
+                blep_gain_[voice] = 0.707f;
+                break;
+            default: blep_gain_[voice] = 0.0f; break;
+        }
+
+        const size_t lane = voice - voice % kWidth;
+        uint32_t     mask = 0;
+        for(size_t v = lane; v < lane + kWidth; v++)
+        {
+            for(uint8_t w = 0; w < Oscillator::WAVE_LAST; w++)
+            {
+                if(weight_[w][v] != 0.0f)
+                    mask |= 1u << w;
+            }
+        }
+        shapes_[lane / kWidth] = mask;
+    }
+
+    /** Sets the waveform of all voices. */
+    void SetWaveform(uint8_t wf)
+    {
+        for(size_t v = 0; v < num_voices; v++)
+            SetWaveform(v, wf);
+    }
+
+    /** Resets the phase of one voice.
+        \param voice - voice index, 0 to num_voices - 1
+        \param phase - phase in cycles, 0.0 to 1.0
+    */
+    void Reset(size_t voice, float phase = 0.0f)
+    {
+        phase_[voice] = fclamp(phase, 0.0f, 0.999999f);
+        next_[voice]  = 0.0f;
+    }
+
+    /** Renders one sample per voice.
+        \param out - num_voices output samples, one per voice
+    */
+    void Process(float *out) { Render(out, 1); }
+
+    /** Renders a block of interleaved frames: sample s of voice v is
+        written to out[s * num_voices + v].
+        \param out - size * num_voices output samples
+        \param size - number of frames to render
+    */
+    void Render(float *out, size_t size)
+    {
+        for(size_t lane = 0; lane < num_voices; lane += kWidth)
+        {
+            RenderLane(lane, out + lane, num_voices, size, false);
+        }
+    }
+
+    /** Renders a block of the sum of all voices.
+        \param out - size output samples
+        \param size - number of samples to render
+    */
+    void RenderMix(float *out, size_t size)
+    {
+        float frame[kMixChunk * kWidth];
+        while(size > 0)
+        {
+            const size_t chunk = DSY_MIN(size, kMixChunk);
+            for(size_t i = 0; i < chunk * kWidth; i++)
+            {
+                frame[i] = 0.0f;
+            }
+            for(size_t lane = 0; lane < num_voices; lane += kWidth)
+            {
+                RenderLane(lane, frame, kWidth, chunk, true);
+            }
+            for(size_t i = 0; i < chunk; i++)
+            {
+                float sum = 0.0f;
+                for(size_t j = 0; j < kWidth; j++)
+                {
+                    sum += frame[i * kWidth + j];
+                }
+                out[i] = sum;
+            }
+            out += chunk;
+            size -= chunk;
+        }
+    }
+
+    /** Returns the phase of one voice, in cycles from 0.0 to 1.0 */
+    inline float GetPhase(size_t voice) const { return phase_[voice]; }
+
+  private:
+    static constexpr size_t   kWidth = simd::LaneWidth<num_voices>::value;
+    static constexpr size_t   kGroups   = num_voices / kWidth;
+    static constexpr size_t   kMixChunk = 32;
+    static constexpr uint32_t kAllShapes = (1u << Oscillator::WAVE_LAST) - 1;
+    static constexpr uint32_t kBlepShapes
+        = (1u << Oscillator::WAVE_POLYBLEP_SAW)
+          | (1u << Oscillator::WAVE_POLYBLEP_SQUARE);
+    typedef simd::FloatVec<kWidth> Vec;
+
+    /* Vector versions of the BLEP residuals in dsp.h */
+    static inline Vec ThisBlep(Vec t) { return 0.5f * t * t; }
+    static inline Vec NextBlep(Vec t)
+    {
+        t = 1.0f - t;
+        return -0.5f * t * t;
+    }
+
+    /* Oscillator's Polyblep(), t and dt in cycles */
+    static inline Vec Polyblep(Vec t, Vec dt, Vec recip)
+    {
+        const Vec below = 1.0f - Step(dt, t);
+        const Vec above = 1.0f - Step(t, 1.0f - dt);
+        const Vec u     = t * recip;
+        const Vec v     = (t - 1.0f) * recip;
+        return below * (u + u - u * u - 1.0f) + above * (v * v + v + v + 1.0f);
+    }
+
+    /* Naive triangle from 0 at phase 0 up to 1 at phase 0.5 */
+    static inline Vec Triangle(Vec p)
+    {
+        const Vec x = 2.0f * p - 1.0f;
+        return 1.0f - Max(x, 0.0f - x);
+    }
+
+    /** Renders kWidth voices starting at lane, frames stride apart,
+        adding to out if accumulate is set */
+    void RenderLane(
+        size_t lane, float *out, size_t stride, size_t size, bool accumulate)
+    {
+        // groups of a single waveform skip all the others
+        switch(shapes_[lane / kWidth])
+        {
+            case 1u << Oscillator::WAVE_SIN:
+                RenderShapes<1u << Oscillator::WAVE_SIN>(
+                    lane, out, stride, size, accumulate);
+                break;
+            case 1u << Oscillator::WAVE_TRI:
+                RenderShapes<1u << Oscillator::WAVE_TRI>(
+                    lane, out, stride, size, accumulate);
+                break;
+            case 1u << Oscillator::WAVE_SAW:
+                RenderShapes<1u << Oscillator::WAVE_SAW>(
+                    lane, out, stride, size, accumulate);
+                break;
+            case 1u << Oscillator::WAVE_RAMP:
+                RenderShapes<1u << Oscillator::WAVE_RAMP>(
+                    lane, out, stride, size, accumulate);
+                break;
+            case 1u << Oscillator::WAVE_SQUARE:
+                RenderShapes<1u << Oscillator::WAVE_SQUARE>(
+                    lane, out, stride, size, accumulate);
+                break;
+            case 1u << Oscillator::WAVE_POLYBLEP_TRI:
+                RenderShapes<1u << Oscillator::WAVE_POLYBLEP_TRI>(
+                    lane, out, stride, size, accumulate);
+                break;
+            case 1u << Oscillator::WAVE_POLYBLEP_SAW:
+                RenderShapes<1u << Oscillator::WAVE_POLYBLEP_SAW>(
+                    lane, out, stride, size, accumulate);
+                break;
+            case 1u << Oscillator::WAVE_POLYBLEP_SQUARE:
+                RenderShapes<1u << Oscillator::WAVE_POLYBLEP_SQUARE>(
+                    lane, out, stride, size, accumulate);
+                break;
+            default:
+                RenderShapes<kAllShapes>(lane, out, stride, size, accumulate);
+                break;
+        }
+    }
+
+    /** RenderLane() for the waveforms in the shapes bit mask */
+    template <uint32_t shapes>
+    void RenderShapes(
+        size_t lane, float *out, size_t stride, size_t size, bool accumulate)
+    {
+        const bool blep  = (shapes & kBlepShapes) != 0;
+        const Vec  inc   = Vec::Load(inc_ + lane);
+        const Vec  recip = Vec::Load(inc_recip_ + lane);
+        const Vec  amp   = Vec::Load(amp_ + lane);
+        const Vec  gain  = Vec::Load(blep_gain_ + lane);
+        Vec        w[Oscillator::WAVE_LAST];
+        for(uint8_t s = 0; s < Oscillator::WAVE_LAST; s++)
+        {
+            w[s] = Vec::Load(weight_[s] + lane);
+        }
+        // Oscillator's leaky integrator coefficient is its increment in
+        // radians
+        const Vec leak  = TWOPI_F * inc;
+        Vec       phase = Vec::Load(phase_ + lane);
+        Vec       next  = Vec::Load(next_ + lane);
+        Vec       tri   = Vec::Load(tri_ + lane);
+
+        for(size_t i = 0; i < size; i++, out += stride)
+        {
+            Vec       sig      = 0.0f;
+            const Vec p        = phase;
+            const Vec unwrap   = p + inc;
+            const Vec wrap     = Step(1.0f, unwrap);
+            phase              = unwrap - wrap;
+            const Vec high     = Step(0.5f, p);
+            const Vec new_high = Step(0.5f, phase);
+
+            if(shapes & (1u << Oscillator::WAVE_SIN))
+                sig = sig + w[Oscillator::WAVE_SIN] * simd::Sin2Pi(p);
+            if(shapes & (1u << Oscillator::WAVE_TRI))
+                sig = sig
+                      + w[Oscillator::WAVE_TRI] * (1.0f - 2.0f * Triangle(p));
+            if(shapes & (1u << Oscillator::WAVE_SAW))
+                sig = sig + w[Oscillator::WAVE_SAW] * (1.0f - 2.0f * p);
+            if(shapes & (1u << Oscillator::WAVE_RAMP))
+                sig = sig + w[Oscillator::WAVE_RAMP] * (2.0f * p - 1.0f);
+            if(shapes & (1u << Oscillator::WAVE_SQUARE))
+                sig = sig + w[Oscillator::WAVE_SQUARE] * (1.0f - 2.0f * high);
+            if(shapes & (1u << Oscillator::WAVE_POLYBLEP_TRI))
+            {
+                const Vec half   = p + 0.5f - high;
+                const Vec square = (1.0f - 2.0f * high)
+                                   + Polyblep(p, inc, recip)
+                                   - Polyblep(half, inc, recip);
+                tri = leak * square + (1.0f - leak) * tri;
+                sig = sig + w[Oscillator::WAVE_POLYBLEP_TRI] * tri;
+            }
+
+            if(blep)
+            {
+                // all BLEP shapes run from 0 to 1, the output is 1 - 2x
+                const Vec cross    = Step(0.5f, unwrap) - high;
+                const Vec t_c      = (unwrap - 0.5f) * recip;
+                const Vec t_w      = phase * recip;
+                Vec       this_smp = next;
+                Vec       next_smp = 0.0f;
+
+                if(shapes & (1u << Oscillator::WAVE_POLYBLEP_SAW))
+                {
+                    const Vec ws = w[Oscillator::WAVE_POLYBLEP_SAW];
+                    this_smp     = this_smp - ws * wrap * ThisBlep(t_w);
+                    next_smp = next_smp + ws * (phase - wrap * NextBlep(t_w));
+                }
+                if(shapes & (1u << Oscillator::WAVE_POLYBLEP_SQUARE))
+                {
+                    const Vec wq = w[Oscillator::WAVE_POLYBLEP_SQUARE];
+                    this_smp
+                        = this_smp
+                          + wq * (cross * ThisBlep(t_c) - wrap * ThisBlep(t_w));
+                    next_smp = next_smp
+                               + wq
+                                     * (new_high + cross * NextBlep(t_c)
+                                        - wrap * NextBlep(t_w));
+                }
+
+                sig  = sig + gain * (1.0f - 2.0f * this_smp);
+                next = next_smp;
+            }
+
+            sig = sig * amp;
+            if(accumulate)
+                sig = sig + Vec::Load(out);
+            sig.Store(out);
+        }
+
+        phase.Store(phase_ + lane);
+        next.Store(next_ + lane);
+        tri.Store(tri_ + lane);
+    }
+
+    float    sr_recip_;
+    float    phase_[num_voices], next_[num_voices], tri_[num_voices];
+    float    inc_[num_voices], inc_recip_[num_voices], amp_[num_voices];
+    float    blep_gain_[num_voices];
+    float    weight_[Oscillator::WAVE_LAST][num_voices];
+    uint32_t shapes_[kGroups];
+};
+} // namespace daisysp
+#endif
+#endif
@@ -144,4 +144,11 @@ void OscillatorBank::SetGain(float gain)
     gain         = gain < 0.f ? 0.f : gain;
     recalc_gain_ = cmp(gain, gain_) || recalc_gain_;
     gain_        = gain;
-}
\ No newline at end of file
+}
+void OscillatorBank::Render(float* out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process();
+    }
+}
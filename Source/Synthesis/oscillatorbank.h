@@ -3,6 +3,7 @@
 #define DSY_OSCILLATORBANK_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 /** @file oscillatorbank.h */
@@ -34,6 +35,12 @@ class OscillatorBank
     */
     float Process();
 
+    /** Renders a block of samples, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float* out, size_t size);
+
     /** Set oscillator frequency (8' oscillator)
         \param freq Frequency in Hz
     */
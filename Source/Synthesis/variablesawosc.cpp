@@ -103,4 +103,11 @@ float VariableSawOscillator::ComputeNaiveSample(float phase,
     float triangle
         = phase < pw ? phase * slope_up : 1.0f - (phase - pw) * slope_down;
     return notch_saw * notch_amount + triangle * triangle_amount;
-}
\ No newline at end of file
+}
+void VariableSawOscillator::Render(float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process();
+    }
+}
@@ -3,6 +3,7 @@
 #define DSY_VARISAWOSCILLATOR_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 /** @file variablesawosc.h */
@@ -28,6 +29,12 @@ class VariableSawOscillator
     /** Get the next sample */
     float Process();
 
+    /** Renders a block of samples, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float *out, size_t size);
+
     /** Set master freq.
         \param frequency Freq in Hz.
     */
@@ -179,4 +179,11 @@ float VariableShapeOscillator::ComputeNaiveSample(float phase,
     saw += (square - saw) * square_amount;
     saw += (triangle - saw) * triangle_amount;
     return saw;
-}
\ No newline at end of file
+}
+void VariableShapeOscillator::Render(float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process();
+    }
+}
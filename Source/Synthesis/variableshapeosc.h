@@ -3,6 +3,7 @@
 #define DSY_VARIABLESHAPEOSCILLATOR_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 /** @file variableshapeosc.h */
@@ -33,6 +34,12 @@ class VariableShapeOscillator
     */
     float Process();
 
+    /** Renders a block of samples, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float *out, size_t size);
+
     /** Set master freq.
         \param frequency Freq in Hz.
     */
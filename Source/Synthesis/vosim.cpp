@@ -78,4 +78,11 @@ void VosimOscillator::SetShape(float shape)
 float VosimOscillator::Sine(float phase)
 {
     return sinf(TWOPI_F * phase);
-}
\ No newline at end of file
+}
+void VosimOscillator::Render(float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process();
+    }
+}
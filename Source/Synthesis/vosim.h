@@ -3,6 +3,7 @@
 #define DSY_VOSIM_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 /** @file vosim.h */
@@ -33,6 +34,12 @@ class VosimOscillator
     */
     float Process();
 
+    /** Renders a block of samples, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float *out, size_t size);
+
     /** Set carrier frequency.
         \param freq Frequency in Hz.
     */
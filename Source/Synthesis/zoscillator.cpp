@@ -156,4 +156,11 @@ inline float ZOscillator::Z(float c, float d, float f, float shape, float mode)
         contour = Sine(c + shape * 0.5f);
     }
     return (ramp_down * (offset + discontinuity) - offset) * contour;
-}
\ No newline at end of file
+}
+void ZOscillator::Render(float *out, size_t size)
+{
+    for(size_t i = 0; i < size; i++)
+    {
+        out[i] = Process();
+    }
+}
@@ -3,6 +3,7 @@
 #define DSY_ZOSCILLATOR_H
 
 #include <stdint.h>
+#include <stddef.h>
 #ifdef __cplusplus
 
 /** @file zoscillator.h */
@@ -32,6 +33,12 @@ class ZOscillator
     */
     float Process();
 
+    /** Renders a block of samples, equivalent to calling Process() size times.
+        \param out - output buffer
+        \param size - number of samples to render
+    */
+    void Render(float *out, size_t size);
+
     /** Set the carrier frequency
         \param freq Frequency in Hz.
     */
@@ -0,0 +1,340 @@
+#pragma once
+#ifndef DSY_ARENA_H
+#define DSY_ARENA_H
+
+#include <assert.h>
+#include <stdint.h>
+#include <stddef.h>
+#ifdef __cplusplus
+#include <atomic>
+#include <new>
+#include <utility>
+
+/** @file arena.h */
+
+namespace daisysp
+{
+/** Real-time safe bump allocator over a user-provided block of memory.
+
+    Allocation is a pointer bump and Reset() releases everything at once,
+    so a whole patch can be built and torn down on every preset change
+    without touching the heap. Both are lock-free, and allocating from
+    several threads at once is safe.
+
+    Reset() does not run destructors. That is fine for the DaisySP modules,
+    which own no resources, but not for types that do.
+
+    The delay based modules take their memory through
+    Init(sample_rate, buffer, size), so with DSY_DELAY_USER_MEMORY defined
+    the objects and their buffers can both come from the arena, sized for
+    the actual sample rate:
+
+    float DSY_SDRAM_BSS patch_memory[256 * 1024];
+    Arena arena;
+    arena.Init(patch_memory, sizeof(patch_memory));
+
+    ReverbSc *verb = arena.New<ReverbSc>();
+    size_t    size = ReverbSc::GetBufferSize(sample_rate);
+    verb->Init(sample_rate, arena.Allocate<float>(size), size);
+
+    arena.Reset(); // on preset change
+*/
+class Arena
+{
+  public:
+    Arena() : base_(nullptr), size_(0), used_(0), high_water_(0) {}
+    ~Arena() {}
+
+    /** Initializes the arena
+        \param buffer - memory to allocate from, must outlive the arena
+        \param size - length of buffer in bytes
+    */
+    void Init(void *buffer, size_t size)
+    {
+        base_ = static_cast<uint8_t *>(buffer);
+        size_ = size;
+        used_.store(0, std::memory_order_relaxed);
+        high_water_.store(0, std::memory_order_relaxed);
+    }
+
+    /** Allocates raw memory
+        \param size - number of bytes
+        \param align - alignment in bytes, a power of two
+        \return the memory, or nullptr if the arena is full
+    */
+    void *Allocate(size_t size, size_t align = alignof(max_align_t))
+    {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(base_);
+        const uintptr_t mask = align - 1;
+        size_t          used = used_.load(std::memory_order_relaxed);
+        size_t          start, end;
+        do
+        {
+            start = ((base + used + mask) & ~mask) - base;
+            end   = start + size;
+            if(end > size_ || end < start)
+                return nullptr;
+        } while(!used_.compare_exchange_weak(
+            used, end, std::memory_order_relaxed, std::memory_order_relaxed));
+
+        size_t high_water = high_water_.load(std::memory_order_relaxed);
+        while(end > high_water
+              && !high_water_.compare_exchange_weak(
+                  high_water, end, std::memory_order_relaxed))
+        {
+        }
+        return base_ + start;
+    }
+
+    /** Allocates an uninitialized array
+        \param count - number of elements
+        \return the array, or nullptr if the arena is full or the size
+        overflows size_t
+    */
+    template <typename T>
+    T *Allocate(size_t count)
+    {
+        // count * sizeof(T) would wrap around to a small size
+        if(count > SIZE_MAX / sizeof(T))
+            return nullptr;
+        return static_cast<T *>(Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /** Constructs an object in the arena
+        \param args - constructor arguments
+        \return the object, or nullptr if the arena is full
+    */
+    template <typename T, typename... Args>
+    T *New(Args &&... args)
+    {
+        void *mem = Allocate(sizeof(T), alignof(T));
+        return mem ? new(mem) T(std::forward<Args>(args)...) : nullptr;
+    }
+
+    /** Releases all allocations at once. Memory handed out before must no
+        longer be used.
+    */
+    void Reset() { used_.store(0, std::memory_order_relaxed); }
+
+    /** Returns the number of bytes currently allocated, including padding */
+    size_t GetUsed() const { return used_.load(std::memory_order_relaxed); }
+
+    /** Returns the size of the arena in bytes */
+    size_t GetCapacity() const { return size_; }
+
+    /** Returns the largest number of bytes allocated at any time since
+        Init() or ResetHighWaterMark()
+    */
+    size_t GetHighWaterMark() const
+    {
+        return high_water_.load(std::memory_order_relaxed);
+    }
+
+    /** Sets the high water mark to the current usage */
+    void ResetHighWaterMark()
+    {
+        high_water_.store(GetUsed(), std::memory_order_relaxed);
+    }
+
+  private:
+    uint8_t *           base_;
+    size_t              size_;
+    std::atomic<size_t> used_;
+    std::atomic<size_t> high_water_;
+};
+
+/** Real-time safe pool of fixed size blocks over a user-provided block of
+    memory.
+
+    Unlike Arena, blocks can be returned one at a time with Free(), which
+    suits objects that come and go independently, like voices or per-note
+    buffers. Allocate() and Free() are lock-free (a tagged free list), and
+    Reset() returns all blocks at once in O(1). Up to 65535 blocks. The
+    free list links take 4 bytes per block at the end of the buffer, so
+    the pool never reads or writes the blocks themselves.
+
+    Pool pool;
+    pool.Init(memory, sizeof(memory), sizeof(Pluck));
+    Pluck *voice = new(pool.Allocate()) Pluck;
+    pool.Free(voice);
+*/
+class Pool
+{
+  public:
+    Pool()
+    : base_(nullptr),
+      links_(nullptr),
+      block_size_(0),
+      num_blocks_(0),
+      head_(kEmpty),
+      fresh_(0),
+      in_use_(0),
+      high_water_(0)
+    {
+    }
+    ~Pool() {}
+
+    /** Initializes the pool
+        \param buffer - memory to carve the blocks from, must outlive the pool
+        \param size - length of buffer in bytes
+        \param block_size - size of each block in bytes
+        \param align - alignment of each block in bytes, a power of two
+    */
+    void Init(void * buffer,
+              size_t size,
+              size_t block_size,
+              size_t align = alignof(max_align_t))
+    {
+        const uintptr_t base = reinterpret_cast<uintptr_t>(buffer);
+        const uintptr_t first
+            = (base + align - 1) & ~static_cast<uintptr_t>(align - 1);
+        block_size  = block_size > 0 ? block_size : 1;
+        block_size_ = (block_size + align - 1) & ~(align - 1);
+        base_       = reinterpret_cast<uint8_t *>(first);
+        size        = first - base < size ? size - (first - base) : 0;
+
+        // Each block needs a link too, the links go after the last block
+        const uintptr_t link_mask = alignof(Link) - 1;
+        size = size > link_mask ? size - link_mask : 0;
+        const size_t num = size / (block_size_ + sizeof(Link));
+        num_blocks_      = static_cast<uint32_t>(num < kEmpty ? num : kEmpty);
+        const uintptr_t links
+            = reinterpret_cast<uintptr_t>(Block(num_blocks_)) + link_mask;
+        links_ = reinterpret_cast<Link *>(links & ~link_mask);
+        for(uint32_t i = 0; i < num_blocks_; i++)
+        {
+            new(&links_[i]) Link(kEmpty);
+        }
+        high_water_.store(0, std::memory_order_relaxed);
+        Reset();
+    }
+
+    /** Takes a block from the pool
+        \return a block of GetBlockSize() bytes, or nullptr if none is left
+    */
+    void *Allocate()
+    {
+        uint32_t head = head_.load(std::memory_order_acquire);
+        while((head & kEmpty) != kEmpty)
+        {
+            const uint32_t index = head & kEmpty;
+            const uint32_t next  = (head & ~kEmpty) + kTagStep
+                                  + links_[index].load(std::memory_order_relaxed);
+            if(head_.compare_exchange_weak(head,
+                                           next,
+                                           std::memory_order_acquire,
+                                           std::memory_order_acquire))
+            {
+                CountAllocation();
+                return Block(index);
+            }
+        }
+
+        // Free list is empty, hand out a block that was never used
+        uint32_t fresh = fresh_.load(std::memory_order_relaxed);
+        while(fresh < num_blocks_)
+        {
+            if(fresh_.compare_exchange_weak(
+                   fresh, fresh + 1, std::memory_order_relaxed))
+            {
+                CountAllocation();
+                return Block(fresh);
+            }
+        }
+        return nullptr;
+    }
+
+    /** Returns a block to the pool
+        \param block - a block from Allocate() since the last Reset(), or
+        nullptr. Blocks handed out before a Reset() must not be freed.
+    */
+    void Free(void *block)
+    {
+        if(block == nullptr)
+            return;
+        const uint32_t index = static_cast<uint32_t>(
+            (static_cast<uint8_t *>(block) - base_) / block_size_);
+        assert(index < fresh_.load(std::memory_order_relaxed));
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        uint32_t next;
+        do
+        {
+            links_[index].store(head & kEmpty, std::memory_order_relaxed);
+            next = (head & ~kEmpty) + kTagStep + index;
+        } while(!head_.compare_exchange_weak(
+            head, next, std::memory_order_release, std::memory_order_relaxed));
+        const size_t in_use = in_use_.fetch_sub(1, std::memory_order_relaxed);
+        assert(in_use > 0);
+        (void)in_use;
+    }
+
+    /** Returns all blocks to the pool at once. Blocks handed out before must
+        no longer be used, nor passed to Free().
+    */
+    void Reset()
+    {
+        head_.store(kEmpty, std::memory_order_relaxed);
+        fresh_.store(0, std::memory_order_relaxed);
+        in_use_.store(0, std::memory_order_relaxed);
+    }
+
+    /** Returns the size of each block in bytes, including padding */
+    size_t GetBlockSize() const { return block_size_; }
+
+    /** Returns the total number of blocks */
+    size_t GetNumBlocks() const { return num_blocks_; }
+
+    /** Returns the number of blocks currently allocated */
+    size_t GetInUse() const { return in_use_.load(std::memory_order_relaxed); }
+
+    /** Returns the largest number of blocks allocated at any time since
+        Init() or ResetHighWaterMark()
+    */
+    size_t GetHighWaterMark() const
+    {
+        return high_water_.load(std::memory_order_relaxed);
+    }
+
+    /** Sets the high water mark to the current usage */
+    void ResetHighWaterMark()
+    {
+        high_water_.store(GetInUse(), std::memory_order_relaxed);
+    }
+
+  private:
+    // The free list head holds a block index in the low 16 bits and a tag
+    // in the high 16 bits, bumped on every change to rule out ABA. The
+    // link of a free block is the index of the next one.
+    typedef std::atomic<uint32_t> Link;
+
+    static constexpr uint32_t kEmpty   = 0xffff;
+    static constexpr uint32_t kTagStep = 0x10000;
+
+    inline uint8_t *Block(uint32_t index) const
+    {
+        return base_ + index * block_size_;
+    }
+
+    void CountAllocation()
+    {
+        size_t in_use = in_use_.fetch_add(1, std::memory_order_relaxed) + 1;
+        size_t high_water = high_water_.load(std::memory_order_relaxed);
+        while(in_use > high_water
+              && !high_water_.compare_exchange_weak(
+                  high_water, in_use, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    uint8_t *             base_;
+    Link *                links_;
+    size_t                block_size_;
+    uint32_t              num_blocks_;
+    std::atomic<uint32_t> head_;
+    std::atomic<uint32_t> fresh_;
+    std::atomic<size_t>   in_use_;
+    std::atomic<size_t>   high_water_;
+};
+} // namespace daisysp
+#endif
+#endif
@@ -2,6 +2,7 @@
 #pragma once
 #ifndef DSY_DCBLOCK_H
 #define DSY_DCBLOCK_H
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -22,6 +23,13 @@ class DcBlock
     */
     float Process(float in);
 
+    /** performs DcBlock Process on a block of samples
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
   private:
     float input_, output_, gain_;
 };
@@ -1,10 +1,91 @@
 #pragma once
 #ifndef DSY_DELAY_H
 #define DSY_DELAY_H
+#include <assert.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include "Utility/dsp.h"
+
+/** Use as max_size of a DelayLine to provide its memory at run time.
+
+    The delay based effects (Chorus, Flanger, Phaser, ReverbSc, PolyPluck)
+    all take their memory through Init(sample_rate, buffer, size) and report
+    the size they need with GetBufferSize(sample_rate). Define
+    DSY_DELAY_USER_MEMORY, for the library build as well, to drop their
+    built-in buffers along with the Init(sample_rate) overloads that use them.
+*/
+#define DELAYLINE_USER_MEMORY 0
+
 namespace daisysp
 {
+namespace delayline_detail
+{
+    /* Smallest power of two >= x. Unlike get_next_power2() this is a
+       single return statement, so it sizes arrays with C++11 too */
+    constexpr size_t NextPower2(size_t x, size_t p = 1)
+    {
+        return p >= x ? p : NextPower2(x, p * 2);
+    }
+} // namespace delayline_detail
+
+/** Helper class that defines the memory model of a DelayLine - internal
+    storage of max_size samples, or user-provided memory if max_size is
+    DELAYLINE_USER_MEMORY.
+
+    Not intended to be used directly, so constructor is not exposed
+*/
+template <typename T, size_t max_size, bool power_of_two>
+class DelayLineMemory
+{
+  public:
+    /** Length of the line in samples */
+    static constexpr size_t kSize
+        = power_of_two ? delayline_detail::NextPower2(max_size) : max_size;
+
+    /** Returns the length of the line in samples */
+    static constexpr size_t GetSize() { return kSize; }
+
+  protected:
+    DelayLineMemory() {}
+
+    inline size_t Wrap(size_t pos) const
+    {
+        return power_of_two ? pos & (kSize - 1) : pos % kSize;
+    }
+
+    T line_[kSize];
+};
+
+template <typename T, bool power_of_two>
+class DelayLineMemory<T, DELAYLINE_USER_MEMORY, power_of_two>
+{
+  public:
+    /** Returns the length of the line in samples */
+    inline size_t GetSize() const { return size_; }
+
+  protected:
+    DelayLineMemory() : line_(nullptr), size_(0), mask_(0) {}
+
+    /* With power_of_two only the largest power of two that fits is used.
+       A line needs at least 2 samples: the delayed one and the one
+       interpolated towards. */
+    void SetBuffer(T *buffer, size_t size)
+    {
+        assert(buffer != nullptr && size >= 2);
+        line_ = buffer;
+        size_ = power_of_two && size > 0 ? get_next_power2(size + 1) / 2 : size;
+        mask_ = size_ - 1;
+    }
+
+    inline size_t Wrap(size_t pos) const
+    {
+        return power_of_two ? pos & mask_ : pos % size_;
+    }
+
+    T *    line_;
+    size_t size_, mask_;
+};
+
 /** Simple Delay line.
 November 2019
 
@@ -14,22 +95,62 @@ declaration example: (1 second of floats)
 
 DelayLine<float, SAMPLE_RATE> del;
 
+With power_of_two set, the length is max_size rounded up to the next
+power of two, and positions wrap with a bit mask instead of an integer
+division. This costs up to twice the memory.
+
+DelayLine<float, 2400, true> del; // 4096 samples
+
+With max_size set to DELAYLINE_USER_MEMORY the line holds no memory of
+its own, and Init(buffer, size) hands it a buffer sized at run time, e.g.
+for the actual sample rate or in a different memory region.
+
+DelayLine<float, DELAYLINE_USER_MEMORY> del;
+float DSY_SDRAM_BSS buffer[96000];
+del.Init(buffer, 96000);
+
 By: shensley
 */
-template <typename T, size_t max_size>
-class DelayLine
+template <typename T, size_t max_size, bool power_of_two = false>
+class DelayLine : public DelayLineMemory<T, max_size, power_of_two>
 {
+  private:
+    using Memory = DelayLineMemory<T, max_size, power_of_two>;
+    using Memory::line_;
+    using Memory::Wrap;
+
   public:
+    using Memory::GetSize;
+
     DelayLine() {}
     ~DelayLine() {}
     /** initializes the delay line by clearing the values within, and setting delay to 1 sample.
     */
-    void Init() { Reset(); }
+    void Init()
+    {
+        static_assert(max_size != DELAYLINE_USER_MEMORY,
+                      "DelayLine: user memory requires Init(buffer, size)");
+        Reset();
+    }
+
+    /** initializes the delay line with user-provided memory, see Init()
+        \param buffer - memory for the delay line, at least size samples
+        \param size - length of the line in samples, at least 2. In
+        power_of_two mode only the largest power of two up to size is used.
+    */
+    void Init(T *buffer, size_t size)
+    {
+        static_assert(max_size == DELAYLINE_USER_MEMORY,
+                      "DelayLine: Init(buffer, size) requires user memory");
+        Memory::SetBuffer(buffer, size);
+        Reset();
+    }
     /** clears buffer, sets write ptr to 0, and delay to 1 sample.
     */
     void Reset()
     {
-        for(size_t i = 0; i < max_size; i++)
+        const size_t size = GetSize();
+        for(size_t i = 0; i < size; i++)
         {
             line_[i] = T(0);
         }
@@ -43,7 +164,7 @@ class DelayLine
     inline void SetDelay(size_t delay)
     {
         frac_  = 0.0f;
-        delay_ = delay < max_size ? delay : max_size - 1;
+        delay_ = delay < GetSize() ? delay : GetSize() - 1;
     }
 
     /** sets the delay time in samples
@@ -53,8 +174,9 @@ class DelayLine
     {
         int32_t int_delay = static_cast<int32_t>(delay);
         frac_             = delay - static_cast<float>(int_delay);
-        delay_ = static_cast<size_t>(int_delay) < max_size ? int_delay
-                                                           : max_size - 1;
+        delay_            = static_cast<size_t>(int_delay) < GetSize()
+                                ? int_delay
+                                : GetSize() - 1;
     }
 
     /** writes the sample of type T to the delay line, and advances the write ptr
@@ -62,38 +184,81 @@ class DelayLine
     inline void Write(const T sample)
     {
         line_[write_ptr_] = sample;
-        write_ptr_        = (write_ptr_ - 1 + max_size) % max_size;
+        write_ptr_        = Wrap(write_ptr_ - 1 + GetSize());
+    }
+
+    /** writes size samples, equivalent to calling Write() for each of them
+    */
+    inline void WriteBlock(const T *in, size_t size)
+    {
+        const size_t last = GetSize() - 1;
+        size_t       w    = write_ptr_;
+        for(size_t i = 0; i < size; i++)
+        {
+            line_[w] = in[i];
+            w        = w == 0 ? last : w - 1;
+        }
+        write_ptr_ = w;
     }
 
     /** returns the next sample of type T in the delay line, interpolated if necessary.
     */
     inline const T Read() const
     {
-        T a = line_[(write_ptr_ + delay_) % max_size];
-        T b = line_[(write_ptr_ + delay_ + 1) % max_size];
+        T a = line_[Wrap(write_ptr_ + delay_)];
+        T b = line_[Wrap(write_ptr_ + delay_ + 1)];
         return a + (b - a) * frac_;
     }
 
+    /** reads size samples at the current delay, ahead of a WriteBlock() of
+        the same size. Together they are equivalent to calling Read() and
+        Write() for each sample, provided the delay is at least size samples.
+    */
+    inline void ReadBlock(T *out, size_t size) const
+    {
+        const size_t base = write_ptr_ + delay_ + GetSize();
+        for(size_t i = 0; i < size; i++)
+        {
+            const T a = line_[Wrap(base - i)];
+            const T b = line_[Wrap(base - i + 1)];
+            out[i]    = a + (b - a) * frac_;
+        }
+    }
+
     /** Read from a set location */
     inline const T Read(float delay) const
     {
         int32_t delay_integral   = static_cast<int32_t>(delay);
         float   delay_fractional = delay - static_cast<float>(delay_integral);
-        const T a = line_[(write_ptr_ + delay_integral) % max_size];
-        const T b = line_[(write_ptr_ + delay_integral + 1) % max_size];
+        const T a = line_[Wrap(write_ptr_ + delay_integral)];
+        const T b = line_[Wrap(write_ptr_ + delay_integral + 1)];
         return a + (b - a) * delay_fractional;
     }
 
+    /** Reads several taps from set locations, equivalent to calling
+        Read(delays[i]) for each of them
+        \param delays - size delays in samples
+        \param out - size output samples
+        \param size - number of taps
+    */
+    inline void ReadMany(const float *delays, T *out, size_t size) const
+    {
+        for(size_t i = 0; i < size; i++)
+        {
+            out[i] = Read(delays[i]);
+        }
+    }
+
     inline const T ReadHermite(float delay) const
     {
         int32_t delay_integral   = static_cast<int32_t>(delay);
         float   delay_fractional = delay - static_cast<float>(delay_integral);
 
-        int32_t     t     = (write_ptr_ + delay_integral + max_size);
-        const T     xm1   = line_[(t - 1) % max_size];
-        const T     x0    = line_[(t) % max_size];
-        const T     x1    = line_[(t + 1) % max_size];
-        const T     x2    = line_[(t + 2) % max_size];
+        int32_t     t     = (write_ptr_ + delay_integral + GetSize());
+        const T     xm1   = line_[Wrap(t - 1)];
+        const T     x0    = line_[Wrap(t)];
+        const T     x1    = line_[Wrap(t + 1)];
+        const T     x2    = line_[Wrap(t + 2)];
         const float c     = (x1 - xm1) * 0.5f;
         const float v     = x0 - x1;
         const float w     = c + v;
@@ -105,7 +270,7 @@ class DelayLine
 
     inline const T Allpass(const T sample, size_t delay, const T coefficient)
     {
-        T read  = line_[(write_ptr_ + delay) % max_size];
+        T read  = line_[Wrap(write_ptr_ + delay)];
         T write = sample + coefficient * read;
         Write(write);
         return -write * coefficient + read;
@@ -115,7 +280,6 @@ class DelayLine
     float  frac_;
     size_t write_ptr_;
     size_t delay_;
-    T      line_[max_size];
 };
 } // namespace daisysp
 #endif
@@ -7,6 +7,8 @@
 #include <cstdint>
 #include <random>
 #include <cmath>
+#include "lut.h"
+#include "simd.h"
 
 /** PIs
 */
@@ -122,7 +124,7 @@ inline float fastlog10f(float f)
 */
 inline float mtof(float m)
 {
-    return powf(2, (m - 69.0f) / 12.0f) * 440.0f;
+    return LutExp2((m - 69.0f) * kOneTwelfth) * 440.0f;
 }
 
 
@@ -137,6 +139,30 @@ inline void fonepole(float &out, float in, float coeff)
     out += coeff * (in - out);
 }
 
+/** Advances a triangle lfo by one sample, shared by the per sample and
+block paths of Chorus, Flanger and Phaser.
+The phase bounces between -1 and 1: past either end it folds back and
+freq changes sign. Both are passed by reference and must be retained
+between calls. Returns the new phase.
+*/
+inline float triangle_lfo(float &phase, float &freq)
+{
+    phase += freq;
+
+    //wrap around and flip direction
+    if(phase > 1.f)
+    {
+        phase = 1.f - (phase - 1.f);
+        freq *= -1.f;
+    }
+    else if(phase < -1.f)
+    {
+        phase = -1.f - (phase + 1.f);
+        freq *= -1.f;
+    }
+    return phase;
+}
+
 /** Curves to use with the fmap function */
 enum class Mapping
 {
@@ -328,6 +354,206 @@ constexpr uint32_t get_next_power2(uint32_t x)
     return x;
 }
 
+/** Fast math kernels for floats and for simd::FloatVec
+
+    Each kernel is a template that works on a single float as well as on
+    a vector of floats, with the same polynomial approximations in both
+    cases. Each one also has an array version that processes in to out
+    (in place is fine) with the widest vector of the target and does any
+    remainder with the scalar version. On targets without vector
+    instructions (e.g. the Cortex-M7 of the Daisy) the array versions are
+    plain loops that the compiler is free to unroll.
+
+    Maximum errors, measured against double precision references:
+    - Exp2(): 1e-7 relative, x is clamped to [-126, 127.49]
+    - Log2(): 1.5e-7 absolute (relative where |log2(x)| > 1),
+      x is clamped to [1.2e-38, 1e38]
+    - Exp(): as Exp2(), plus about |x| * 6e-8 relative from the rounding
+      of x * log2(e)
+    - Tanh(): 2e-7 absolute
+    - Sin(), Cos(): 8e-7 absolute for |x| <= 2 pi, the rounding of the
+      argument reduction adds about |x| * 6e-8 for larger inputs
+    - Sin2Pi(): 2.1e-7 absolute, phase in cycles, |phase| < 2^22
+    - Tan(): 3e-6 relative for |x| <= 1.5
+    - SoftClip(): 2.4e-7 absolute against the scalar SoftClip()
+    - Mtof(): 6e-7 relative
+    - DbToGain(): 8e-7 relative
+    - GainToDb(): 1.2e-5 dB absolute, for gains down to -120 dB
+*/
+namespace simd
+{
+    /** 2^x */
+    template <typename T>
+    inline T Exp2(T x)
+    {
+        x         = Min(Max(x, -126.0f), 127.49f);
+        const T n = Round(x);
+        const T f = x - n; /* in [-0.5, 0.5] */
+        /* Taylor series of 2^f, the terms are ln(2)^k / k! */
+        T p = f * 1.52527338e-05f + 1.54035304e-04f;
+        p   = p * f + 1.33335581e-03f;
+        p   = p * f + 9.61812911e-03f;
+        p   = p * f + 5.55041087e-02f;
+        p   = p * f + 2.40226507e-01f;
+        p   = p * f + 6.93147181e-01f;
+        p   = p * f + 1.0f;
+        return p * Pow2i(n);
+    }
+
+    /** log2(x), x > 0 */
+    template <typename T>
+    inline T Log2(T x)
+    {
+        x = Min(Max(x, 1.17549435e-38f), 1.0e38f);
+        /* exponent rounded to nearest, leaves m in [0.75, 1.5] */
+        const T e = Round(Log2Linear(x));
+        const T m = x * Pow2i(0.0f - e);
+        /* ln(m) = 2 atanh(s), |s| <= 0.2 */
+        const T s  = (m - 1.0f) / (m + 1.0f);
+        const T s2 = s * s;
+        T       p  = s2 * (1.0f / 9.0f) + (1.0f / 7.0f);
+        p          = p * s2 + (1.0f / 5.0f);
+        p          = p * s2 + (1.0f / 3.0f);
+        p          = p * s2 + 1.0f;
+        /* 2 / ln(2) */
+        return e + s * p * 2.88539008f;
+    }
+
+    /** e^x */
+    template <typename T>
+    inline T Exp(T x)
+    {
+        return Exp2(x * 1.44269504f);
+    }
+
+    /** Hyperbolic tangent */
+    template <typename T>
+    inline T Tanh(T x)
+    {
+        /* tanh(x) = 1 - 2 / (e^2x + 1), 1 within float precision at 9 */
+        x         = Min(Max(x, -9.0f), 9.0f);
+        const T e = Exp2(x * 2.88539008f);
+        return 1.0f - 2.0f / (e + 1.0f);
+    }
+
+    /** sin(2 pi phase), phase in cycles */
+    template <typename T>
+    inline T Sin2Pi(T phase)
+    {
+        T r = phase - Round(phase); /* in [-0.5, 0.5] */
+        /* fold into [-0.25, 0.25], sin(pi - a) = sin(a) */
+        r         = Max(Min(r, 0.5f - r), -0.5f - r);
+        const T y = r * 6.28318531f;
+        const T y2 = y * y;
+        /* Taylor series to y^11 */
+        T p = y2 * -2.50521084e-08f + 2.75573192e-06f;
+        p   = p * y2 - 1.98412698e-04f;
+        p   = p * y2 + 8.33333333e-03f;
+        p   = p * y2 - 1.66666667e-01f;
+        p   = p * y2 + 1.0f;
+        return y * p;
+    }
+
+    /** sin(x), x in radians */
+    template <typename T>
+    inline T Sin(T x)
+    {
+        return Sin2Pi(x * 0.159154943f);
+    }
+
+    /** cos(x), x in radians */
+    template <typename T>
+    inline T Cos(T x)
+    {
+        return Sin2Pi(x * 0.159154943f + 0.25f);
+    }
+
+    /** tan(x), x in radians */
+    template <typename T>
+    inline T Tan(T x)
+    {
+        const T phase = x * 0.159154943f;
+        return Sin2Pi(phase) / Sin2Pi(phase + 0.25f);
+    }
+
+    /** Soft clipping, see SoftClip() */
+    template <typename T>
+    inline T SoftClip(T x)
+    {
+        x          = Min(Max(x, -3.0f), 3.0f);
+        const T x2 = x * x;
+        return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+    }
+
+    /** Midi note number to frequency */
+    template <typename T>
+    inline T Mtof(T m)
+    {
+        return Exp2((m - 69.0f) * kOneTwelfth) * 440.0f;
+    }
+
+    /** Decibels to linear gain */
+    template <typename T>
+    inline T DbToGain(T db)
+    {
+        /* log2(10) / 20 */
+        return Exp2(db * 0.166096405f);
+    }
+
+    /** Linear gain to decibels, gain > 0 */
+    template <typename T>
+    inline T GainToDb(T gain)
+    {
+        /* 20 log10(2) */
+        return Log2(gain) * 6.02059991f;
+    }
+
+    /** Applies a kernel to an array, vectors first, then scalars */
+    template <FloatVec<kNativeWidth> (*vec_kernel)(FloatVec<kNativeWidth>),
+              float (*scalar_kernel)(float)>
+    inline void Transform(const float *in, float *out, size_t size)
+    {
+        typedef FloatVec<kNativeWidth> Vec;
+        size_t i = 0;
+        for(; i + Vec::kWidth <= size; i += Vec::kWidth)
+        {
+            vec_kernel(Vec::Load(in + i)).Store(out + i);
+        }
+        for(; i < size; i++)
+        {
+            out[i] = scalar_kernel(in[i]);
+        }
+    }
+
+#define DSY_SIMD_ARRAY_KERNEL(name)                                 \
+    inline void name(const float *in, float *out, size_t size)      \
+    {                                                               \
+        Transform<name<FloatVec<kNativeWidth>>, name<float>>(       \
+            in, out, size);                                         \
+    }
+
+    /** Array versions, in to out, may run in place
+        \param in - size input values
+        \param out - size output values
+        \param size - number of values
+    */
+    DSY_SIMD_ARRAY_KERNEL(Exp2)
+    DSY_SIMD_ARRAY_KERNEL(Log2)
+    DSY_SIMD_ARRAY_KERNEL(Exp)
+    DSY_SIMD_ARRAY_KERNEL(Tanh)
+    DSY_SIMD_ARRAY_KERNEL(Sin2Pi)
+    DSY_SIMD_ARRAY_KERNEL(Sin)
+    DSY_SIMD_ARRAY_KERNEL(Cos)
+    DSY_SIMD_ARRAY_KERNEL(Tan)
+    DSY_SIMD_ARRAY_KERNEL(SoftClip)
+    DSY_SIMD_ARRAY_KERNEL(Mtof)
+    DSY_SIMD_ARRAY_KERNEL(DbToGain)
+    DSY_SIMD_ARRAY_KERNEL(GainToDb)
+
+#undef DSY_SIMD_ARRAY_KERNEL
+
+} // namespace simd
+
 } // namespace daisysp
 #endif
 
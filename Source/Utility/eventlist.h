@@ -0,0 +1,207 @@
+#pragma once
+#ifndef DSY_EVENTLIST_H
+#define DSY_EVENTLIST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#ifdef __cplusplus
+
+/** @file eventlist.h */
+
+namespace daisysp
+{
+/** One event inside a block, see EventList */
+struct BlockEvent
+{
+    /** Event types understood by the modules, user types start at USER */
+    enum Type
+    {
+        TRIGGER,  /**< strikes a voice or starts an envelope */
+        GATE_ON,  /**< opens a gate, e.g. a MIDI note on */
+        GATE_OFF, /**< closes a gate, e.g. a MIDI note off */
+        USER,
+    };
+
+    uint32_t offset; /**< samples from the start of the block */
+    uint8_t  type;   /**< one of Type */
+    float    value;  /**< velocity or other user data */
+};
+
+/** Events of a block, sorted by their sample offset.
+
+    Block rendering loses the timing of triggers that per sample Process()
+    calls had. An EventList keeps it: events are added with their offset
+    inside the block, and RenderTriggered() / RenderGated() split the
+    block at the events and render every part with the module's block
+    Render(), so a block gives the same output as a Process() loop with
+    triggers at those samples.
+
+    \code
+    EventList<16> events;
+    AnalogBassDrum kick;
+
+    // audio callback, MIDI notes carry their offset in the block
+    events.Add(note_offset, BlockEvent::TRIGGER, velocity);
+    RenderTriggered(kick, events, out, size);
+    events.Advance(size);
+    \endcode
+
+    Offsets may be past the end of the block. Those events are kept by
+    Advance() and come due in a later block, so events can be scheduled
+    ahead of time.
+
+    \param capacity - maximum number of events
+*/
+template <size_t capacity>
+class EventList
+{
+  public:
+    EventList() : count_(0) {}
+    ~EventList() {}
+
+    /** Removes all events */
+    void Clear() { count_ = 0; }
+
+    /** Adds an event, after the events already at the same offset
+        \param offset - samples from the start of the block
+        \param type - one of BlockEvent::Type
+        \param value - velocity or other user data
+        \return false if the list is full
+    */
+    bool
+    Add(size_t offset, uint8_t type = BlockEvent::TRIGGER, float value = 1.f)
+    {
+        if(count_ >= capacity)
+            return false;
+        // Events mostly arrive in order, so this rarely moves any
+        size_t i = count_;
+        while(i > 0 && events_[i - 1].offset > offset)
+        {
+            events_[i] = events_[i - 1];
+            i--;
+        }
+        events_[i].offset = static_cast<uint32_t>(offset);
+        events_[i].type   = type;
+        events_[i].value  = value;
+        count_++;
+        return true;
+    }
+
+    /** Removes an event
+        \param index - position in the list, 0 is the earliest event.
+        Out of range indices are ignored.
+    */
+    void Remove(size_t index)
+    {
+        if(index >= count_)
+            return;
+        for(size_t i = index + 1; i < count_; i++)
+        {
+            events_[i - 1] = events_[i];
+        }
+        count_--;
+    }
+
+    /** Drops the events of a finished block and moves the offsets of the
+        later ones to the next block
+        \param size - number of samples in the finished block
+    */
+    void Advance(size_t size)
+    {
+        size_t first = 0;
+        while(first < count_ && events_[first].offset < size)
+        {
+            first++;
+        }
+        for(size_t i = first; i < count_; i++)
+        {
+            events_[i - first] = events_[i];
+            events_[i - first].offset -= static_cast<uint32_t>(size);
+        }
+        count_ -= first;
+    }
+
+    /** Returns the number of events */
+    size_t GetCount() const { return count_; }
+
+    /** Returns an event, 0 is the earliest */
+    const BlockEvent &operator[](size_t index) const { return events_[index]; }
+
+  private:
+    BlockEvent events_[capacity];
+    size_t     count_;
+};
+
+/** Renders a block of a triggered module, striking it at every TRIGGER
+    event with an offset inside the block. The module needs a
+    Render(bool trigger, float *out, size_t size) method, like the drums,
+    ModalVoice, StringVoice or AdEnv. Other event types are ignored.
+    \param module - module to render
+    \param events - events of the block
+    \param out - output buffer
+    \param size - number of samples to render
+*/
+template <typename Module, size_t capacity>
+void RenderTriggered(Module &                   module,
+                     const EventList<capacity> &events,
+                     float *                    out,
+                     size_t                     size)
+{
+    size_t start   = 0;
+    bool   trigger = false;
+    for(size_t i = 0; i < events.GetCount(); i++)
+    {
+        const BlockEvent &event = events[i];
+        if(event.offset >= size)
+            break;
+        if(event.type != BlockEvent::TRIGGER)
+            continue;
+        if(event.offset > start)
+        {
+            module.Render(trigger, out + start, event.offset - start);
+            start = event.offset;
+        }
+        trigger = true;
+    }
+    module.Render(trigger, out + start, size - start);
+}
+
+/** Renders a block of a gated module, opening and closing the gate at
+    every GATE_ON and GATE_OFF event with an offset inside the block. The
+    module needs a Render(bool gate, float *out, size_t size) method, like
+    Adsr. Other event types are ignored.
+    \param module - module to render
+    \param gate - gate at the start of the block, left at its state at
+    the end of the block for the next one
+    \param events - events of the block
+    \param out - output buffer
+    \param size - number of samples to render
+*/
+template <typename Module, size_t capacity>
+void RenderGated(Module &                   module,
+                 bool &                     gate,
+                 const EventList<capacity> &events,
+                 float *                    out,
+                 size_t                     size)
+{
+    size_t start = 0;
+    for(size_t i = 0; i < events.GetCount(); i++)
+    {
+        const BlockEvent &event = events[i];
+        if(event.offset >= size)
+            break;
+        if(event.type != BlockEvent::GATE_ON
+           && event.type != BlockEvent::GATE_OFF)
+            continue;
+        if(event.offset > start)
+        {
+            module.Render(gate, out + start, event.offset - start);
+            start = event.offset;
+        }
+        gate = event.type == BlockEvent::GATE_ON;
+    }
+    module.Render(gate, out + start, size - start);
+}
+} // namespace daisysp
+#endif
+#endif
@@ -0,0 +1,193 @@
+#pragma once
+#ifndef DSY_FFT_H
+#define DSY_FFT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+#include "Utility/dsp.h"
+#ifdef __cplusplus
+
+/** @file fft.h */
+
+namespace daisysp
+{
+/** Real-input FFT of a fixed, power of two size.
+
+    Portable radix-2 implementation that does not depend on CMSIS DSP.
+    All tables are stored in the object, no heap allocation. Init() fills
+    them.
+
+    Spectra use the packed layout of CMSIS arm_rfft_fast_f32:
+    - spectrum[0] - real part of bin 0 (DC)
+    - spectrum[1] - real part of bin size / 2 (Nyquist)
+    - spectrum[2k], spectrum[2k + 1] - real and imaginary part of bin k,
+      for 0 < k < size / 2
+
+    \param size - transform length, a power of two >= 4
+*/
+template <size_t size>
+class RealFft
+{
+  public:
+    static_assert(size >= 4 && (size & (size - 1)) == 0,
+                  "RealFft: size must be a power of two >= 4");
+
+    RealFft() {}
+    ~RealFft() {}
+
+    /** Fills the twiddle and bit reversal tables. */
+    void Init()
+    {
+        for(size_t k = 0; k < kHalf; k++)
+        {
+            const double phase = -kTwoPi * static_cast<double>(k) / size;
+            cos_[k]            = static_cast<float>(cos(phase));
+            sin_[k]            = static_cast<float>(sin(phase));
+        }
+
+        size_t bits = 0;
+        while((size_t(1) << bits) < kHalf)
+        {
+            bits++;
+        }
+        for(size_t i = 0; i < kHalf; i++)
+        {
+            size_t r = 0;
+            for(size_t b = 0; b < bits; b++)
+            {
+                r |= ((i >> b) & 1u) << (bits - 1u - b);
+            }
+            bitrev_[i] = static_cast<uint16_t>(r);
+        }
+    }
+
+    /** Forward transform, may run in place
+        \param in - size real samples
+        \param spectrum - size floats, packed spectrum (see class description)
+    */
+    void Forward(const float *in, float *spectrum)
+    {
+        /* even samples as real, odd samples as imaginary part */
+        float *z = work_;
+        for(size_t i = 0; i < kHalf; i++)
+        {
+            const size_t r = bitrev_[i];
+            z[2 * r]       = in[2 * i];
+            z[2 * r + 1]   = in[2 * i + 1];
+        }
+        Transform(z);
+
+        /* split the half size complex spectrum into the real spectrum */
+        float *x = spectrum;
+        x[0]     = z[0] + z[1];
+        x[1]     = z[0] - z[1];
+        for(size_t k = 1; k <= kHalf / 2; k++)
+        {
+            const size_t j   = kHalf - k;
+            const float  ar  = z[2 * k], ai = z[2 * k + 1];
+            const float  br  = z[2 * j], bi = z[2 * j + 1];
+            const float  er  = 0.5f * (ar + br);
+            const float  ei  = 0.5f * (ai - bi);
+            const float  orr = 0.5f * (ai + bi);
+            const float  oi  = -0.5f * (ar - br);
+            const float  wr  = cos_[k], wi = sin_[k];
+            const float  tr  = wr * orr - wi * oi;
+            const float  ti  = wr * oi + wi * orr;
+
+            x[2 * k]     = er + tr;
+            x[2 * k + 1] = ei + ti;
+            x[2 * j]     = er - tr;
+            x[2 * j + 1] = -(ei - ti);
+        }
+    }
+
+    /** Inverse transform, scaled so that Inverse(Forward(x)) == x.
+        May run in place.
+        \param spectrum - size floats, packed spectrum
+        \param out - size real samples
+    */
+    void Inverse(const float *spectrum, float *out)
+    {
+        /* merge the real spectrum into a half size complex spectrum,
+           conjugated so that the forward kernel computes the inverse */
+        const float *x = spectrum;
+        float *      z = work_;
+        z[0]           = 0.5f * (x[0] + x[1]);
+        z[1]           = -0.5f * (x[0] - x[1]);
+        for(size_t k = 1; k <= kHalf / 2; k++)
+        {
+            const size_t j  = kHalf - k;
+            const float  ar = x[2 * k], ai = x[2 * k + 1];
+            const float  br = x[2 * j], bi = x[2 * j + 1];
+            const float  er = 0.5f * (ar + br);
+            const float  ei = 0.5f * (ai - bi);
+            const float  dr = 0.5f * (ar - br);
+            const float  di = 0.5f * (ai + bi);
+            const float  wr = cos_[k], wi = -sin_[k];
+            const float  orr = dr * wr - di * wi;
+            const float  oi  = dr * wi + di * wr;
+
+            z[2 * k]     = er - oi;
+            z[2 * k + 1] = -(ei + orr);
+            z[2 * j]     = er + oi;
+            z[2 * j + 1] = -(-ei + orr);
+        }
+
+        float *y = out;
+        for(size_t i = 0; i < kHalf; i++)
+        {
+            const size_t r = bitrev_[i];
+            y[2 * r]       = z[2 * i];
+            y[2 * r + 1]   = z[2 * i + 1];
+        }
+        Transform(y);
+
+        const float scale = 1.0f / kHalf;
+        for(size_t i = 0; i < kHalf; i++)
+        {
+            y[2 * i]     = y[2 * i] * scale;
+            y[2 * i + 1] = -y[2 * i + 1] * scale;
+        }
+    }
+
+  private:
+    static constexpr size_t kHalf  = size / 2;
+    static constexpr double kTwoPi = 6.283185307179586476925286766559;
+
+    /* In-place radix-2 decimation in time on kHalf complex values,
+       input in bit reversed order */
+    void Transform(float *z)
+    {
+        for(size_t len = 2; len <= kHalf; len <<= 1)
+        {
+            const size_t half   = len >> 1;
+            const size_t stride = size / len; // twiddle step in the table
+            for(size_t start = 0; start < kHalf; start += len)
+            {
+                for(size_t k = 0; k < half; k++)
+                {
+                    const float  wr = cos_[k * stride];
+                    const float  wi = sin_[k * stride];
+                    const size_t a  = 2 * (start + k);
+                    const size_t b  = a + 2 * half;
+                    const float  tr = wr * z[b] - wi * z[b + 1];
+                    const float  ti = wr * z[b + 1] + wi * z[b];
+                    z[b]            = z[a] - tr;
+                    z[b + 1]        = z[a + 1] - ti;
+                    z[a] += tr;
+                    z[a + 1] += ti;
+                }
+            }
+        }
+    }
+
+    float    cos_[kHalf];
+    float    sin_[kHalf];
+    uint16_t bitrev_[kHalf];
+    float    work_[size];
+};
+
+} // namespace daisysp
+#endif
+#endif
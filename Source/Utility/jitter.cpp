@@ -14,16 +14,15 @@
 using namespace daisysp;
 
 
+// Same ranges as the rand() based versions, 0 to 0.5 and 0 to 1
 float Jitter::randGab()
 {
-    return (float)((rand() >> 1) & 0x7fffffff)
-           * (4.656612875245796924105750827168e-10);
+    return rng_.NextFloat() * 0.5f;
 }
 
 float Jitter::biRandGab()
 {
-    return (float)(rand() & 0x7fffffff)
-           * (4.656612875245796924105750827168e-10);
+    return rng_.NextFloat();
 }
 
 void Jitter::SetAmp(float amp)
@@ -54,6 +53,7 @@ void Jitter::Reset()
 void Jitter::Init(float sample_rate)
 {
     sample_rate_ = sample_rate;
+    rng_.Reset();
     amp_         = 0.5;
     cps_min_     = 0.5;
     cps_max_     = 4;
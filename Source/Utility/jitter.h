@@ -2,6 +2,9 @@
 #ifndef DAISY_JITTER
 #define DAISY_JITTER
 
+#include <stdint.h>
+#include "random.h"
+
 namespace daisysp
 {
 /** Randomly segmented line generator \n 
@@ -43,11 +46,15 @@ class Jitter
     */
     void SetAmp(float amp);
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
     float   amp_, cps_min_, cps_max_, cps_, sample_rate_;
     int32_t phs_;
     bool    init_flag_;
     float   num1_, num2_, dfd_max_;
+    Random  rng_;
     float   randGab();
     float   biRandGab();
     void    Reset();
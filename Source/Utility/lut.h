@@ -0,0 +1,263 @@
+#pragma once
+#ifndef DSY_LUT_H
+#define DSY_LUT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#ifdef __cplusplus
+
+/** @file lut.h
+
+    Shared lookup tables for the transcendental functions used in the
+    parameter and coefficient paths of the modules (filter tuning, pitch,
+    envelopes, gain).
+
+    The tables are generated at compile time (constexpr), are read-only and
+    exist once per program no matter how many modules use them, so they can
+    live in flash. The accessors interpolate with a second (exp2) or third
+    (sine) order correction, and are accurate to a few float ulps:
+    - LutSin(), LutCos(), LutSinCos() - sine and cosine, phase in cycles
+    - LutTan() - tan(pi * f), for frequency warping with f = freq / sr
+    - LutExp2(), LutExp() - powers of 2 and e
+    - LutSemitonesToRatio() - pitch intervals
+    - LutDbToGain() - decibels to linear gain
+*/
+
+namespace daisysp
+{
+/** Fixed size table of floats that can be built in a constant expression */
+template <size_t size>
+struct LutTable
+{
+    constexpr float operator[](size_t i) const { return data[i]; }
+
+    float data[size];
+};
+
+/** Number of sine table entries per cycle */
+static constexpr size_t kLutSineSize = 256;
+/** Number of exp2 table entries per octave */
+static constexpr size_t kLutExp2Size = 256;
+
+namespace lut_detail
+{
+    static constexpr double kPi  = 3.14159265358979323846;
+    static constexpr double kLn2 = 0.69314718055994530942;
+
+    /* The generators below are single return statements, recursion in
+       place of loops, so that the tables build with C++11 constexpr too */
+
+    /* Ratio of Taylor term k of the sine to term k - 1 */
+    constexpr double SinFactor(double x, int k)
+    {
+        return -x * x / ((2.0 * k) * (2.0 * k + 1.0));
+    }
+
+    /* Adds terms k to 19 of the sine series to sum, term is term k - 1 */
+    constexpr double SinSeries(double x, int k, double term, double sum)
+    {
+        return k < 20 ? SinSeries(x,
+                                  k + 1,
+                                  term * SinFactor(x, k),
+                                  sum + term * SinFactor(x, k))
+                      : sum;
+    }
+
+    /* Taylor series, x in [-pi, pi] */
+    constexpr double Sin(double x)
+    {
+        return SinSeries(x, 1, x, x);
+    }
+
+    /* Adds terms k to 19 of the 2^x series to sum, term is term k - 1 */
+    constexpr double Exp2Series(double x, int k, double term, double sum)
+    {
+        return k < 20 ? Exp2Series(x,
+                                   k + 1,
+                                   term * (x * kLn2 / k),
+                                   sum + term * (x * kLn2 / k))
+                      : sum;
+    }
+
+    /* Taylor series, x in [0, 1] */
+    constexpr double Exp2(double x)
+    {
+        return Exp2Series(x, 1, 1.0, 1.0);
+    }
+
+    /* Sine of the angle x in [0, 2 pi) */
+    constexpr float SineAt(double x)
+    {
+        return static_cast<float>(Sin(x > kPi ? x - 2.0 * kPi : x));
+    }
+
+    /* Entry i of the sine table */
+    constexpr float SineEntry(size_t i)
+    {
+        return SineAt(2.0 * kPi * (i % kLutSineSize) / kLutSineSize);
+    }
+
+    /* Entry i of the exp2 table */
+    constexpr float Exp2Entry(size_t i)
+    {
+        return static_cast<float>(Exp2(1.0 * i / kLutExp2Size));
+    }
+
+    /* Index sequence 0 ... n - 1, to fill a table in one initializer */
+    template <size_t... i>
+    struct Indices
+    {
+    };
+
+    template <size_t n, size_t... i>
+    struct MakeIndices : MakeIndices<n - 1, n - 1, i...>
+    {
+    };
+
+    template <size_t... i>
+    struct MakeIndices<0, i...>
+    {
+        typedef Indices<i...> Type;
+    };
+
+    template <size_t... i>
+    constexpr LutTable<sizeof...(i)> MakeSine(Indices<i...>)
+    {
+        return LutTable<sizeof...(i)>{{SineEntry(i)...}};
+    }
+
+    template <size_t... i>
+    constexpr LutTable<sizeof...(i)> MakeExp2(Indices<i...>)
+    {
+        return LutTable<sizeof...(i)>{{Exp2Entry(i)...}};
+    }
+
+    /* One cycle of sine, plus a quarter cycle so that the cosine of any
+       entry is found kLutSineSize / 4 entries later, plus one guard */
+    constexpr LutTable<kLutSineSize * 5 / 4 + 1> MakeSine()
+    {
+        return MakeSine(MakeIndices<kLutSineSize * 5 / 4 + 1>::Type());
+    }
+
+    /* One octave of 2^x, plus one guard */
+    constexpr LutTable<kLutExp2Size + 1> MakeExp2()
+    {
+        return MakeExp2(MakeIndices<kLutExp2Size + 1>::Type());
+    }
+
+    /* Tables are static members of a class template so that a single
+       instance is shared by all translation units */
+    template <typename T = void>
+    struct Tables
+    {
+        static constexpr LutTable<kLutSineSize * 5 / 4 + 1> sine = MakeSine();
+        static constexpr LutTable<kLutExp2Size + 1>         exp2 = MakeExp2();
+    };
+
+    template <typename T>
+    constexpr LutTable<kLutSineSize * 5 / 4 + 1> Tables<T>::sine;
+    template <typename T>
+    constexpr LutTable<kLutExp2Size + 1> Tables<T>::exp2;
+
+} // namespace lut_detail
+
+/** Sine and cosine of the same phase
+    \param phase - in cycles, any value, wraps around
+    \param sin - sin(2 * pi * phase)
+    \param cos - cos(2 * pi * phase)
+*/
+inline void LutSinCos(float phase, float *sin, float *cos)
+{
+    constexpr float kStep = 2.0f * static_cast<float>(lut_detail::kPi)
+                            / kLutSineSize;
+    const float *   table = lut_detail::Tables<>::sine.data;
+
+    phase -= static_cast<float>(static_cast<int32_t>(phase));
+    if(phase < 0.0f)
+        phase += 1.0f;
+    const float   index = phase * kLutSineSize;
+    const int32_t i     = static_cast<int32_t>(index);
+    /* angle from the table entry, |d| < 2 pi / kLutSineSize */
+    const float d  = (index - i) * kStep;
+    const float d2 = d * d;
+    const float s  = table[i];
+    const float c  = table[i + kLutSineSize / 4];
+    /* angle sum identities with third order sin(d) and cos(d) */
+    const float sd = d - d * d2 * (1.0f / 6.0f);
+    const float cd = 1.0f - 0.5f * d2;
+    *sin           = s * cd + c * sd;
+    *cos           = c * cd - s * sd;
+}
+
+/** sin(2 * pi * phase), phase in cycles, wraps around */
+inline float LutSin(float phase)
+{
+    float s, c;
+    LutSinCos(phase, &s, &c);
+    return s;
+}
+
+/** cos(2 * pi * phase), phase in cycles, wraps around */
+inline float LutCos(float phase)
+{
+    float s, c;
+    LutSinCos(phase, &s, &c);
+    return c;
+}
+
+/** tan(pi * f), as used for bilinear frequency warping
+    \param f - normalized frequency (freq / sample_rate), 0 to below 0.5
+*/
+inline float LutTan(float f)
+{
+    float s, c;
+    LutSinCos(0.5f * f, &s, &c);
+    return s / c;
+}
+
+/** 2 to the power of x, for x between -126 and 128 (clamped) */
+inline float LutExp2(float x)
+{
+    constexpr float kStep = static_cast<float>(lut_detail::kLn2) / kLutExp2Size;
+    const float *   table = lut_detail::Tables<>::exp2.data;
+
+    x = x < -126.0f ? -126.0f : (x > 127.999f ? 127.999f : x);
+
+    /* floor without a branch, the offset keeps the conversion positive */
+    const int32_t integral = static_cast<int32_t>(x + 128.0f) - 128;
+    const float   index    = (x - integral) * kLutExp2Size;
+    const int32_t i     = static_cast<int32_t>(index);
+    /* remaining exponent in natural units, d < ln(2) / kLutExp2Size */
+    const float d        = (index - i) * kStep;
+    const float mantissa = table[i] * (1.0f + d * (1.0f + 0.5f * d));
+
+    /* 2^integral straight from the exponent bits */
+    const uint32_t bits = static_cast<uint32_t>(integral + 127) << 23;
+    float          scale;
+    memcpy(&scale, &bits, sizeof(scale));
+    return mantissa * scale;
+}
+
+/** e to the power of x, for x between -87 and 88 (clamped) */
+inline float LutExp(float x)
+{
+    return LutExp2(x * 1.44269504088896340736f);
+}
+
+/** Frequency ratio of an interval, 2^(semitones / 12) */
+inline float LutSemitonesToRatio(float semitones)
+{
+    return LutExp2(semitones * (1.0f / 12.0f));
+}
+
+/** Linear gain of a level in decibels, 10^(db / 20) */
+inline float LutDbToGain(float db)
+{
+    /* log2(10) / 20 */
+    return LutExp2(db * 0.16609640474436811739f);
+}
+
+} // namespace daisysp
+#endif
+#endif
@@ -3,6 +3,8 @@
 #define DSY_MAYTRIG_H
 
 #include <stdint.h>
+#include "eventlist.h"
+#include "random.h"
 #ifdef __cplusplus
 
 namespace daisysp
@@ -26,10 +28,31 @@ class Maytrig
     */
     inline float Process(float prob)
     {
-        return ((float)rand() / (float)RAND_MAX) <= prob ? true : false;
+        return rng_.NextFloat() <= prob ? true : false;
     }
 
+    /** Keeps each TRIGGER event of a list with a probability, same as
+        calling Process(prob) at each of them in order
+        \param events - events of the block, thinned out in place
+        \param prob (1 keeps all triggers, 0 removes them)
+    */
+    template <size_t capacity>
+    void Process(EventList<capacity> &events, float prob)
+    {
+        for(size_t i = 0; i < events.GetCount();)
+        {
+            if(events[i].type == BlockEvent::TRIGGER && !Process(prob))
+                events.Remove(i);
+            else
+                i++;
+        }
+    }
+
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
+    Random rng_;
 };
 } // namespace daisysp
 #endif
@@ -2,6 +2,8 @@
 #ifndef DSY_METRO_H
 #define DSY_METRO_H
 #include <stdint.h>
+#include <stddef.h>
+#include "eventlist.h"
 #ifdef __cplusplus
 
 namespace daisysp
@@ -26,6 +28,27 @@ class Metro
     */
     uint8_t Process();
 
+    /** Adds the ticks of a block to an event list as TRIGGER events, same
+        as calling Process() size times
+        \param events - list the ticks are added to
+        \param size - number of samples
+        \return number of ticks, some may be missing from a full list
+    */
+    template <size_t capacity>
+    size_t Render(EventList<capacity> &events, size_t size)
+    {
+        size_t ticks = 0;
+        for(size_t i = 0; i < size; i++)
+        {
+            if(Process())
+            {
+                events.Add(i);
+                ticks++;
+            }
+        }
+        return ticks;
+    }
+
     /** resets phase to 0
     */
     inline void Reset() { phs_ = 0.0f; }
@@ -0,0 +1,113 @@
+#pragma once
+#ifndef DSY_OVERSAMPLED_H
+#define DSY_OVERSAMPLED_H
+
+#include <stddef.h>
+#include "Filters/polyphase.h"
+#ifdef __cplusplus
+
+/** @file oversampled.h */
+
+namespace daisysp
+{
+/** Runs a single module at a multiple of the audio rate.
+
+    The input is upsampled with a PolyphaseUpsampler, the wrapped module
+    processes factor samples for every input sample and its output is
+    filtered and decimated back with a PolyphaseDownsampler. Only the
+    nonlinear module pays for the higher rate, the rest of the engine can
+    stay at the base rate.
+
+    The module is initialized by the user, at the high rate:
+    \code
+    Oversampled<MoogLadder, 4> ladder;
+    ladder.Init();
+    ladder.GetModule().Init(sample_rate * ladder.GetFactor());
+    \endcode
+
+    \param Module - any module with a float Process(float) method
+    \param factor - oversampling factor, e.g. 2, 4 or 8
+    \param taps_per_phase - resampling filter length per phase, at least 16
+    \param max_block - internal block size at the base rate
+*/
+template <typename Module,
+          size_t factor,
+          size_t taps_per_phase = 32,
+          size_t max_block      = 48>
+class Oversampled
+{
+  public:
+    Oversampled() {}
+    ~Oversampled() {}
+
+    /** Initializes the resampling filters, but not the module */
+    void Init()
+    {
+        up_.Init();
+        down_.Init();
+    }
+
+    /** Clears the resampling filters, but not the module */
+    void Reset()
+    {
+        up_.Reset();
+        down_.Reset();
+    }
+
+    /** Wrapped module, initialize it at sample_rate * GetFactor() */
+    Module &GetModule() { return module_; }
+
+    /** Oversampling factor */
+    static constexpr size_t GetFactor() { return factor; }
+
+    /** Latency added by the resampling filters, in samples at the base
+        rate. This may be a fraction of a sample.
+    */
+    static constexpr float GetLatency()
+    {
+        return (Up::GetLatency() + Down::GetLatency()) / factor;
+    }
+
+    /** Processes one sample at the base rate */
+    float Process(float in)
+    {
+        float buf[factor];
+        up_.Process(in, buf);
+        for(size_t i = 0; i < factor; i++)
+        {
+            buf[i] = module_.Process(buf[i]);
+        }
+        return down_.Process(buf);
+    }
+
+    /** Processes a block of any length at the base rate, may run in place */
+    void ProcessBlock(const float *in, float *out, size_t size)
+    {
+        while(size > 0)
+        {
+            const size_t chunk = size < max_block ? size : max_block;
+            up_.ProcessBlock(in, buf_, chunk);
+            for(size_t i = 0; i < chunk * factor; i++)
+            {
+                buf_[i] = module_.Process(buf_[i]);
+            }
+            down_.ProcessBlock(buf_, out, chunk);
+            in += chunk;
+            out += chunk;
+            size -= chunk;
+        }
+    }
+
+  private:
+    typedef PolyphaseUpsampler<factor, taps_per_phase, max_block>   Up;
+    typedef PolyphaseDownsampler<factor, taps_per_phase, max_block> Down;
+
+    Module module_;
+    Up     up_;
+    Down   down_;
+    float  buf_[max_block * factor];
+};
+
+} // namespace daisysp
+#endif
+#endif
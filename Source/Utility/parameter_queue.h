@@ -0,0 +1,288 @@
+#pragma once
+#ifndef DSY_PARAMETER_QUEUE_H
+#define DSY_PARAMETER_QUEUE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "dsp.h"
+#ifdef __cplusplus
+#include <atomic>
+
+/** @file parameter_queue.h */
+
+namespace daisysp
+{
+/** One parameter change, see ParameterQueue */
+struct ParameterChange
+{
+    uint32_t id;    /**< parameter index, chosen by the user */
+    uint32_t time;  /**< sample time it applies at, if timed */
+    float    value; /**< new value */
+    bool     timed; /**< false to apply at the next block boundary */
+};
+
+/** Lock-free queue carrying parameter changes from one control thread to
+    the audio thread.
+
+    Exactly one thread may Push() and exactly one other thread may Pop().
+    Neither side ever blocks or allocates: a full queue makes Push()
+    return false, an empty one makes Pop() return false.
+
+    \param capacity - number of changes the queue holds, a power of two
+    \param T - type of the changes
+*/
+template <size_t capacity, typename T = ParameterChange>
+class ParameterQueue
+{
+  public:
+    static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0,
+                  "ParameterQueue: capacity must be a power of two");
+
+    ParameterQueue() : write_(0), read_(0) {}
+    ~ParameterQueue() {}
+
+    /** Empties the queue. Neither thread may use it during the call. */
+    void Init()
+    {
+        write_.store(0, std::memory_order_relaxed);
+        read_.store(0, std::memory_order_relaxed);
+    }
+
+    /** Adds a change, from the control thread
+        \return false if the queue is full
+    */
+    bool Push(const T &change)
+    {
+        const uint32_t write = write_.load(std::memory_order_relaxed);
+        if(write - read_.load(std::memory_order_acquire) >= capacity)
+            return false;
+        changes_[write & kMask] = change;
+        write_.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Looks at the oldest change without removing it, from the audio
+        thread
+        \return false if the queue is empty
+    */
+    bool Peek(T &change) const
+    {
+        const uint32_t read = read_.load(std::memory_order_relaxed);
+        if(read == write_.load(std::memory_order_acquire))
+            return false;
+        change = changes_[read & kMask];
+        return true;
+    }
+
+    /** Removes the oldest change, from the audio thread
+        \return false if the queue is empty
+    */
+    bool Pop(T &change)
+    {
+        if(!Peek(change))
+            return false;
+        read_.store(read_.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_release);
+        return true;
+    }
+
+    /** Returns the number of changes waiting, exact on either thread
+        only while the other one is idle
+    */
+    size_t GetCount() const
+    {
+        return write_.load(std::memory_order_acquire)
+               - read_.load(std::memory_order_acquire);
+    }
+
+  private:
+    static constexpr uint32_t kMask = capacity - 1;
+
+    T                     changes_[capacity];
+    std::atomic<uint32_t> write_;
+    std::atomic<uint32_t> read_;
+};
+
+/** A set of parameters written by a control thread and read by the
+    audio thread, through a ParameterQueue.
+
+    The control thread calls Set(), which never blocks. The audio thread
+    calls Update() at the start of a block, or of each part of a block
+    for sample accurate changes, and reads the values from there on. Get()
+    is the latest value, GetState() is the value a ParameterInterpolator
+    ramps from, so parameters glide to their new values over a block:
+
+    \code
+    enum { FREQ, RES, NUM_PARAMS };
+    ParameterSet<NUM_PARAMS> params;
+
+    // control thread
+    params.Set(FREQ, 1200.f);                      // next block
+    params.Set(RES, 0.7f, params.GetTime() + 480); // 10 ms later
+
+    // audio callback
+    for(size_t done = 0; done < size;)
+    {
+        size_t                n = params.Update(size - done);
+        ParameterInterpolator freq(
+            params.GetState(FREQ), params.Get(FREQ), n);
+        filter.SetRes(params.Get(RES));
+        for(size_t i = 0; i < n; i++)
+        {
+            filter.SetFreq(freq.Next());
+            ...
+        }
+        done += n;
+    }
+    \endcode
+
+    Timed changes are given in samples of the audio thread's clock, which
+    starts at 0 on Init(), advances with every Update(), and wraps
+    around. Timed changes must be pushed in time order, a change for a
+    time that has passed is applied right away. Changes without a time
+    have a queue of their own and never wait behind timed ones, they
+    apply at the next Update(). Changes that come due in the same
+    Update() apply in the order they were set.
+
+    \param num_params - number of parameters, ids are 0 to num_params - 1
+    \param capacity - changes of either kind that can be pending at once,
+    a power of two
+*/
+template <size_t num_params, size_t capacity = 64>
+class ParameterSet
+{
+  public:
+    ParameterSet() : time_(0), next_time_(0), seq_(0) {}
+    ~ParameterSet() {}
+
+    /** Sets every parameter to value, and the clock to 0. Neither thread
+        may use the set during the call.
+    */
+    void Init(float value = 0.0f)
+    {
+        timed_.Init();
+        untimed_.Init();
+        seq_ = 0;
+        for(size_t i = 0; i < num_params; i++)
+        {
+            values_[i] = value;
+            states_[i] = value;
+        }
+        time_.store(0, std::memory_order_relaxed);
+        next_time_ = 0;
+    }
+
+    /** Changes a parameter, from the control thread
+        \param param - parameter id
+        \param value - new value
+        \return false if the queue is full or param is out of range
+    */
+    bool Set(size_t param, float value)
+    {
+        return Push(param, value, 0, false);
+    }
+
+    /** Changes a parameter at a given sample time, from the control thread
+        \param param - parameter id
+        \param value - new value
+        \param time - sample time, see GetTime()
+        \return false if the queue is full or param is out of range
+    */
+    bool Set(size_t param, float value, uint32_t time)
+    {
+        return Push(param, value, time, true);
+    }
+
+    /** Applies the changes that are due and advances the clock, from the
+        audio thread
+        \param size - samples left in the block
+        \return number of samples, at most size, until the next timed
+        change. Process those, then call Update() again for the rest.
+    */
+    size_t Update(size_t size)
+    {
+        // the previous segment has been processed
+        const uint32_t now = next_time_;
+
+        // Apply what is due from both queues, in the order it was set
+        Entry timed, untimed;
+        bool  has_timed = timed_.Peek(timed);
+        for(;;)
+        {
+            const bool due
+                = has_timed
+                  && static_cast<int32_t>(timed.change.time - now) <= 0;
+            const bool has_untimed = untimed_.Peek(untimed);
+            if(due
+               && (!has_untimed
+                   || static_cast<int32_t>(timed.seq - untimed.seq) < 0))
+            {
+                values_[timed.change.id] = timed.change.value;
+                timed_.Pop(timed);
+                has_timed = timed_.Peek(timed);
+            }
+            else if(has_untimed)
+            {
+                values_[untimed.change.id] = untimed.change.value;
+                untimed_.Pop(untimed);
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        size_t todo = size;
+        if(has_timed)
+        {
+            todo = DSY_MIN(static_cast<size_t>(timed.change.time - now), size);
+        }
+        next_time_ = now + static_cast<uint32_t>(todo);
+        time_.store(now, std::memory_order_relaxed);
+        return todo;
+    }
+
+    /** Returns the current value of a parameter, on the audio thread */
+    float Get(size_t param) const { return values_[param]; }
+
+    /** Returns the smoothing state of a parameter, for a
+        ParameterInterpolator ramping to Get()
+    */
+    float *GetState(size_t param) { return &states_[param]; }
+
+    /** Returns the sample time of the last Update(), readable from any
+        thread
+    */
+    uint32_t GetTime() const { return time_.load(std::memory_order_relaxed); }
+
+  private:
+    // A change and its place in the order of Set() calls
+    struct Entry
+    {
+        ParameterChange change;
+        uint32_t        seq;
+    };
+
+    bool Push(size_t param, float value, uint32_t time, bool timed)
+    {
+        if(param >= num_params)
+            return false;
+        Entry entry;
+        entry.change.id    = static_cast<uint32_t>(param);
+        entry.change.time  = time;
+        entry.change.value = value;
+        entry.change.timed = timed;
+        entry.seq          = seq_++;
+        return timed ? timed_.Push(entry) : untimed_.Push(entry);
+    }
+
+    ParameterQueue<capacity, Entry> timed_, untimed_;
+    float                           values_[num_params];
+    float                           states_[num_params];
+    std::atomic<uint32_t>           time_;
+    uint32_t                        next_time_;
+    uint32_t                        seq_; // written by the control thread
+};
+} // namespace daisysp
+#endif
+#endif
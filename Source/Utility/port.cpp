@@ -31,3 +31,25 @@ float Port::Process(float in)
 
     return yt1_ = c1_ * in + c2_ * yt1_;
 }
+
+void Port::ProcessBlock(const float *in, float *out, size_t size)
+{
+    if(prvhtim_ != htime_)
+    {
+        c2_      = pow(0.5, onedsr_ / htime_);
+        c1_      = 1.0 - c2_;
+        prvhtim_ = htime_;
+    }
+
+    const float c1  = c1_;
+    const float c2  = c2_;
+    float       yt1 = yt1_;
+
+    for(size_t i = 0; i < size; i++)
+    {
+        yt1    = c1 * in[i] + c2 * yt1;
+        out[i] = yt1;
+    }
+
+    yt1_ = yt1;
+}
@@ -2,6 +2,7 @@
 #pragma once
 #ifndef DSY_PORT_H
 #define DSY_PORT_H
+#include <stddef.h>
 #ifdef __cplusplus
 
 namespace daisysp
@@ -41,6 +42,13 @@ class Port
     */
     float Process(float in);
 
+    /** Applies portamento to a block of samples.
+        \param in - input buffer, may be the same as out
+        \param out - output buffer
+        \param size - number of samples to process
+    */
+    void ProcessBlock(const float *in, float *out, size_t size);
+
 
     /** Sets htime
     */
@@ -0,0 +1,124 @@
+#pragma once
+#ifndef DSY_RANDOM_H
+#define DSY_RANDOM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#ifdef __cplusplus
+
+/** @file random.h */
+
+namespace daisysp
+{
+/** Fast random number generator with per-instance state.
+
+    Replaces rand(), which shares one generator (and in glibc one lock)
+    between all callers. Each generator owns its 32 bit state, so modules
+    running on different threads never touch each other's numbers.
+
+    It is counter based: the state steps by a constant (a Weyl sequence)
+    and each number is a hash of the state. Numbers can therefore be
+    computed independently, and Fill() is a plain loop the compiler
+    vectorizes. It gives the same numbers as calling NextFloat() in a loop.
+
+    Generators start from kDefaultSeed, and the modules restart theirs
+    from its seed in Init(), so a module gives the same output after every
+    Init(). Two instances with the same settings give the same output too,
+    call SetSeed() with different seeds to make them differ.
+*/
+class Random
+{
+  public:
+    /** Seed of a generator until SetSeed() is called */
+    static constexpr uint32_t kDefaultSeed = 0;
+
+    Random() : seed_(kDefaultSeed) { Reset(); }
+    ~Random() {}
+
+    /** Sets the seed and restarts the sequence
+        \param seed - any value, each seed gives a different sequence
+    */
+    void SetSeed(uint32_t seed)
+    {
+        seed_ = seed;
+        Reset();
+    }
+
+    /** Restarts the sequence from the seed */
+    void Reset() { state_ = Hash(seed_); }
+
+    /** Returns a random 32 bit integer */
+    inline uint32_t NextUint()
+    {
+        state_ += kStep;
+        return Hash(state_);
+    }
+
+    /** Returns a random float from 0.0 to just below 1.0 */
+    inline float NextFloat() { return ToUnipolar(NextUint()); }
+
+    /** Returns a random float from -1.0 to just below 1.0 */
+    inline float NextBipolar() { return ToBipolar(NextUint()); }
+
+    /** Fills a buffer with NextFloat() values
+        \param out - output buffer
+        \param size - number of values
+        \param gain - every value is multiplied by this
+    */
+    void Fill(float *out, size_t size, float gain = 1.f)
+    {
+        uint32_t state = state_;
+        for(size_t i = 0; i < size; i++)
+        {
+            state += kStep;
+            out[i] = ToUnipolar(Hash(state)) * gain;
+        }
+        state_ = state;
+    }
+
+    /** Fills a buffer with NextBipolar() values
+        \param out - output buffer
+        \param size - number of values
+        \param gain - every value is multiplied by this
+    */
+    void FillBipolar(float *out, size_t size, float gain = 1.f)
+    {
+        uint32_t state = state_;
+        for(size_t i = 0; i < size; i++)
+        {
+            state += kStep;
+            out[i] = ToBipolar(Hash(state)) * gain;
+        }
+        state_ = state;
+    }
+
+    /** Integer hash with good avalanche (Chris Wellons' lowbias32) */
+    static inline uint32_t Hash(uint32_t x)
+    {
+        x ^= x >> 16;
+        x *= 0x21f0aaadu;
+        x ^= x >> 15;
+        x *= 0x735a2d97u;
+        x ^= x >> 15;
+        return x;
+    }
+
+  private:
+    // 2^32 / golden ratio, odd, so the state visits all 2^32 values
+    static constexpr uint32_t kStep = 0x9e3779b9u;
+
+    static inline float ToUnipolar(uint32_t x)
+    {
+        return (float)(x >> 8) * (1.f / 16777216.f);
+    }
+
+    static inline float ToBipolar(uint32_t x)
+    {
+        return (float)(x >> 8) * (2.f / 16777216.f) - 1.f;
+    }
+
+    uint32_t seed_, state_;
+};
+} // namespace daisysp
+#endif
+#endif
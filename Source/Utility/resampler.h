@@ -0,0 +1,255 @@
+#pragma once
+#ifndef DSY_RESAMPLER_H
+#define DSY_RESAMPLER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include "Utility/dsp.h"
+#ifdef __cplusplus
+
+/** @file resampler.h */
+
+namespace daisysp
+{
+/** Streaming sample rate converter for arbitrary, time-varying ratios.
+
+    Band limited interpolation with a Kaiser windowed sinc (beta = 8, about
+    80 dB of stopband rejection) stored in a table of 128 phases per zero
+    crossing. Phases in between are linearly interpolated. The fractional
+    position of each output sample is kept in a phase accumulator, so the
+    ratio can be changed at any time without discontinuities. This makes
+    it usable both for fixed conversions (e.g. 44.1 kHz material in a
+    48 kHz engine) and for varispeed playback, with ratio = 1 / speed.
+
+    When the ratio is below 1 (decimation, or playback faster than normal)
+    the filter is stretched to the lower output Nyquist frequency, up to a
+    factor of max_stretch. Lower ratios are clamped.
+
+    Quality is set by zero_crossings, the number of input samples on each
+    side of the interpolated position: 8 is cheap (passband to about 0.34
+    of the input sample rate), 16 is good (0.42), 32 is transparent (0.46).
+    The cost per output sample is 2 * zero_crossings / min(ratio, 1)
+    multiply-adds.
+
+    \param zero_crossings - filter half length in input samples, >= 8
+    \param max_stretch - lowest supported ratio is 1 / max_stretch
+*/
+template <size_t zero_crossings = 16, size_t max_stretch = 4>
+class Resampler
+{
+  public:
+    static_assert(zero_crossings >= 8,
+                  "Resampler: zero_crossings must be at least 8");
+    static_assert(max_stretch >= 1, "Resampler: max_stretch must be >= 1");
+
+    Resampler() {}
+    ~Resampler() {}
+
+    /** Initializes the converter
+        \param ratio - output sample rate / input sample rate
+    */
+    void Init(float ratio)
+    {
+        BuildTable();
+        Reset();
+        SetRatio(ratio);
+    }
+
+    /** Clears the input history and the phase accumulator */
+    void Reset()
+    {
+        memset(ring_, 0, sizeof(ring_));
+        pos_     = 0;
+        frac_    = 0.0f;
+        advance_ = 1; /* the first output is centered on the first input */
+    }
+
+    /** Sets the conversion ratio, takes effect with the next output sample
+        \param ratio - output sample rate / input sample rate,
+        or 1 / playback speed for varispeed. Clamped to >= 1 / max_stretch.
+    */
+    void SetRatio(float ratio)
+    {
+        ratio_ = DSY_MAX(ratio, 1.0f / max_stretch);
+        step_  = 1.0f / ratio_;
+        scale_ = DSY_MIN(ratio_, 1.0f);
+        taps_  = DSY_MIN(
+            static_cast<size_t>(ceilf(zero_crossings / scale_)), kHalf);
+    }
+
+    /** Returns the current conversion ratio */
+    inline float GetRatio() const { return ratio_; }
+
+    /** Delay of the filter, in input samples */
+    static constexpr size_t GetLatency() { return kHalf; }
+
+    /** Returns the number of input samples that have to be passed to
+        Process() to produce exactly out_size output samples
+        at the current ratio.
+    */
+    size_t GetInputNeeded(size_t out_size) const
+    {
+        if(out_size == 0)
+            return 0;
+        size_t needed = advance_;
+        float  frac   = frac_;
+        for(size_t i = 1; i < out_size; i++)
+        {
+            frac += step_;
+            const size_t adv = static_cast<size_t>(frac);
+            frac -= adv;
+            needed += adv;
+        }
+        return needed;
+    }
+
+    /** Converts as much as possible of a block.
+        Stops when either all of the input has been consumed or out_size
+        output samples have been written, whatever comes first.
+        \param in - input samples
+        \param in_size - number of input samples available
+        \param out - output samples
+        \param out_size - maximum number of output samples to write
+        \param in_used - number of input samples consumed, or nullptr
+        \return number of output samples written
+    */
+    size_t Process(const float *in,
+                   size_t       in_size,
+                   float *      out,
+                   size_t       out_size,
+                   size_t *     in_used)
+    {
+        size_t n_in = 0, n_out = 0;
+        while(n_out < out_size)
+        {
+            /* feed the history until the next output position is reached */
+            while(advance_ > 0 && n_in < in_size)
+            {
+                Push(in[n_in++]);
+                advance_--;
+            }
+            if(advance_ > 0)
+                break;
+
+            out[n_out++] = Interpolate();
+
+            frac_ += step_;
+            advance_ = static_cast<size_t>(frac_);
+            frac_ -= advance_;
+        }
+        if(in_used)
+            *in_used = n_in;
+        return n_out;
+    }
+
+  private:
+    static constexpr size_t kPhases = 128;
+    /* one sided filter table, zero padded by two zero crossings so that
+       the last (partial) taps can be looked up without range checks */
+    static constexpr size_t kFilterSize = zero_crossings * kPhases;
+    static constexpr size_t kTableSize  = kFilterSize + 2 * kPhases + 2;
+    /* input samples on each side of the interpolated position */
+    static constexpr size_t kHalf = zero_crossings * max_stretch;
+    static constexpr size_t kRing = 2 * kHalf;
+
+    void BuildTable()
+    {
+        const double kBeta = 8.0;
+        const double kPi   = 3.14159265358979323846;
+        /* cutoff relative to Nyquist, stopband edge at Nyquist */
+        const double cutoff = 1.0 - 2.55 / zero_crossings;
+
+        /* zeroth order modified Bessel function of the first kind */
+        auto bessel_i0 = [](double x) {
+            double sum = 1.0, term = 1.0;
+            for(int k = 1; k < 50 && term > 1.0e-12 * sum; k++)
+            {
+                term *= (x * x) / (4.0 * k * k);
+                sum += term;
+            }
+            return sum;
+        };
+
+        const double norm = bessel_i0(kBeta);
+        for(size_t i = 0; i < kFilterSize; i++)
+        {
+            const double t    = static_cast<double>(i) / kPhases;
+            const double r    = t / zero_crossings;
+            const double w    = bessel_i0(kBeta * sqrt(1.0 - r * r)) / norm;
+            const double x    = kPi * cutoff * t;
+            const double sinc = i == 0 ? 1.0 : sin(x) / x;
+            table_[i]         = static_cast<float>(cutoff * sinc * w);
+        }
+        for(size_t i = kFilterSize; i < kTableSize; i++)
+        {
+            table_[i] = 0.0f;
+        }
+    }
+
+    /* Mirrored ring, ring_ + pos_ always holds kRing contiguous samples */
+    inline void Push(float in)
+    {
+        ring_[pos_]         = in;
+        ring_[pos_ + kRing] = in;
+        pos_                = pos_ + 1 == kRing ? 0 : pos_ + 1;
+    }
+
+    /* Filter value at u = distance in input samples * kPhases */
+    inline float Tap(float u) const
+    {
+        const size_t k = static_cast<size_t>(u);
+        const float  f = u - k;
+        return table_[k] + f * (table_[k + 1] - table_[k]);
+    }
+
+    /* Output at frac_ input samples after the center of the window */
+    float Interpolate() const
+    {
+        /* x[kHalf - 1] is the sample at or just before the position */
+        const float *x     = ring_ + pos_;
+        const float  scale = scale_ * kPhases;
+
+        float acc = 0.0f;
+        if(scale_ >= 1.0f)
+        {
+            /* unstretched, the table phase is the same for all taps */
+            const float  ul = frac_ * kPhases;
+            const float  ur = (1.0f - frac_) * kPhases;
+            const size_t kl = static_cast<size_t>(ul);
+            const size_t kr = static_cast<size_t>(ur);
+            const float  fl = ul - kl;
+            const float  fr = ur - kr;
+            for(size_t i = 0; i < taps_; i++)
+            {
+                const float *tl = table_ + kl + i * kPhases;
+                const float *tr = table_ + kr + i * kPhases;
+                acc += (tl[0] + fl * (tl[1] - tl[0])) * x[kHalf - 1 - i];
+                acc += (tr[0] + fr * (tr[1] - tr[0])) * x[kHalf + i];
+            }
+            return acc;
+        }
+
+        for(size_t i = 0; i < taps_; i++)
+        {
+            /* samples before the position, at distance i + frac_ */
+            acc += Tap((i + frac_) * scale) * x[kHalf - 1 - i];
+            /* samples after the position, at distance i + 1 - frac_ */
+            acc += Tap((i + 1.0f - frac_) * scale) * x[kHalf + i];
+        }
+        return acc * scale_;
+    }
+
+    float  table_[kTableSize];
+    float  ring_[2 * kRing];
+    size_t pos_;
+    float  frac_;
+    size_t advance_;
+    float  ratio_, step_, scale_;
+    size_t taps_;
+};
+
+} // namespace daisysp
+#endif
+#endif
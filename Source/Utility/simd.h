@@ -0,0 +1,503 @@
+#pragma once
+#ifndef DSY_SIMD_H
+#define DSY_SIMD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#ifdef __cplusplus
+
+/** @file simd.h
+ *
+ *  Minimal portable float vector used by the structure-of-arrays modules
+ *  (SvfBank, ...). The instruction set is picked at compile time:
+ *  - AVX (8 lanes) when compiled with -mavx or higher
+ *  - SSE2 (4 lanes) on any x86-64 host
+ *  - NEON (4 lanes) on ARMv7-A/ARMv8 with NEON
+ *  - plain arrays elsewhere (e.g. the Cortex-M7 of the Daisy), which
+ *    the compiler is free to unroll.
+ *
+ *  Define DSY_SIMD_DISABLE to force the plain array fallback.
+ *
+ *  Besides arithmetic, Min() and Max(), the vectors provide the building
+ *  blocks of the fast math kernels in dsp.h: Round(), Pow2i() and
+ *  Log2Linear(). All of them have scalar float overloads with the same
+ *  semantics, so generic code can run on floats as well as on vectors.
+ *
+ *  FloatVec<4> also has Transpose(), which transposes four vectors as the
+ *  rows of a 4x4 matrix, to switch between one vector per channel and one
+ *  vector per sample.
+ *
+ *  There are no lane masks. Comparisons go through Step(), which returns
+ *  1.0 or 0.0 per lane (and has a scalar overload as well), and per-lane
+ *  choices are made by multiplying.
+ */
+
+#if !defined(DSY_SIMD_DISABLE)
+#if defined(__AVX__)
+#define DSY_SIMD_AVX 1
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DSY_SIMD_SSE 1
+#include <emmintrin.h>
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DSY_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+#endif // DSY_SIMD_DISABLE
+
+namespace daisysp
+{
+namespace simd
+{
+/** Widest vector natively supported by the target */
+#if defined(DSY_SIMD_AVX)
+static constexpr size_t kNativeWidth = 8;
+#else
+static constexpr size_t kNativeWidth = 4;
+#endif
+
+/** Vector width used for a bank of n lanes.
+    Uses the native width when it divides n, 4 lanes otherwise.
+*/
+template <size_t n>
+struct LaneWidth
+{
+    static constexpr size_t value = (n % kNativeWidth == 0) ? kNativeWidth : 4;
+};
+
+/** Scalar versions of the vector operations */
+inline float Min(float a, float b)
+{
+    return a < b ? a : b;
+}
+inline float Max(float a, float b)
+{
+    return a > b ? a : b;
+}
+
+/** Nearest integer, |a| < 2^31. Halfway cases may round either way. */
+inline float Round(float a)
+{
+    const float half = a < 0.0f ? -0.5f : 0.5f;
+    return static_cast<float>(static_cast<int32_t>(a + half));
+}
+
+/** 2^n straight from the exponent bits, n integer in [-126, 127] */
+inline float Pow2i(float n)
+{
+    const int32_t bits = static_cast<int32_t>((n + 127.0f) * 8388608.0f);
+    float         r;
+    memcpy(&r, &bits, sizeof(r));
+    return r;
+}
+
+/** 1.0 where x >= edge, 0.0 otherwise */
+inline float Step(float edge, float x)
+{
+    return x >= edge ? 1.0f : 0.0f;
+}
+
+/** Piecewise linear estimate of log2(a), exact at powers of two,
+    from the bit pattern of a > 0. The error is below 0.09.
+*/
+inline float Log2Linear(float a)
+{
+    int32_t bits;
+    memcpy(&bits, &a, sizeof(bits));
+    return static_cast<float>(bits) * (1.0f / 8388608.0f) - 127.0f;
+}
+
+/** Vector of width floats. Loads and stores do not require alignment. */
+template <size_t width>
+class FloatVec;
+
+template <>
+class FloatVec<4>
+{
+  public:
+    static constexpr size_t kWidth = 4;
+
+    FloatVec() {}
+
+#if defined(DSY_SIMD_SSE)
+    FloatVec(float x) : v_(_mm_set1_ps(x)) {}
+    static inline FloatVec Load(const float *p)
+    {
+        return FloatVec(_mm_loadu_ps(p));
+    }
+    inline void Store(float *p) const { _mm_storeu_ps(p, v_); }
+
+    friend inline FloatVec operator+(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm_add_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec operator-(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm_sub_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec operator*(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm_mul_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec operator/(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm_div_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec Min(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm_min_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec Max(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm_max_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec Round(FloatVec a)
+    {
+        return FloatVec(_mm_cvtepi32_ps(_mm_cvtps_epi32(a.v_)));
+    }
+    friend inline FloatVec Pow2i(FloatVec n)
+    {
+        const __m128 e = _mm_mul_ps(_mm_add_ps(n.v_, _mm_set1_ps(127.0f)),
+                                    _mm_set1_ps(8388608.0f));
+        return FloatVec(_mm_castsi128_ps(_mm_cvtps_epi32(e)));
+    }
+    friend inline FloatVec Log2Linear(FloatVec a)
+    {
+        const __m128 bits  = _mm_cvtepi32_ps(_mm_castps_si128(a.v_));
+        const __m128 scale = _mm_set1_ps(1.0f / 8388608.0f);
+        return FloatVec(
+            _mm_sub_ps(_mm_mul_ps(bits, scale), _mm_set1_ps(127.0f)));
+    }
+    friend inline FloatVec Step(FloatVec edge, FloatVec x)
+    {
+        return FloatVec(
+            _mm_and_ps(_mm_cmpge_ps(x.v_, edge.v_), _mm_set1_ps(1.0f)));
+    }
+    friend inline void
+    Transpose(FloatVec &a, FloatVec &b, FloatVec &c, FloatVec &d)
+    {
+        _MM_TRANSPOSE4_PS(a.v_, b.v_, c.v_, d.v_);
+    }
+
+  private:
+    explicit FloatVec(__m128 v) : v_(v) {}
+    __m128 v_;
+#elif defined(DSY_SIMD_NEON)
+    FloatVec(float x) : v_(vdupq_n_f32(x)) {}
+    static inline FloatVec Load(const float *p)
+    {
+        return FloatVec(vld1q_f32(p));
+    }
+    inline void Store(float *p) const { vst1q_f32(p, v_); }
+
+    friend inline FloatVec operator+(FloatVec a, FloatVec b)
+    {
+        return FloatVec(vaddq_f32(a.v_, b.v_));
+    }
+    friend inline FloatVec operator-(FloatVec a, FloatVec b)
+    {
+        return FloatVec(vsubq_f32(a.v_, b.v_));
+    }
+    friend inline FloatVec operator*(FloatVec a, FloatVec b)
+    {
+        return FloatVec(vmulq_f32(a.v_, b.v_));
+    }
+    friend inline FloatVec operator/(FloatVec a, FloatVec b)
+    {
+#if defined(__aarch64__)
+        return FloatVec(vdivq_f32(a.v_, b.v_));
+#else
+        // two Newton-Raphson steps on the reciprocal estimate
+        float32x4_t r = vrecpeq_f32(b.v_);
+        r             = vmulq_f32(vrecpsq_f32(b.v_, r), r);
+        r             = vmulq_f32(vrecpsq_f32(b.v_, r), r);
+        return FloatVec(vmulq_f32(a.v_, r));
+#endif
+    }
+    friend inline FloatVec Min(FloatVec a, FloatVec b)
+    {
+        return FloatVec(vminq_f32(a.v_, b.v_));
+    }
+    friend inline FloatVec Max(FloatVec a, FloatVec b)
+    {
+        return FloatVec(vmaxq_f32(a.v_, b.v_));
+    }
+    friend inline FloatVec Round(FloatVec a)
+    {
+#if defined(__aarch64__)
+        return FloatVec(vrndnq_f32(a.v_));
+#else
+        // truncate, then step away from zero where the remainder is >= 0.5
+        const float32x4_t t   = vcvtq_f32_s32(vcvtq_s32_f32(a.v_));
+        const float32x4_t r   = vsubq_f32(a.v_, t);
+        const uint32x4_t  one = vreinterpretq_u32_f32(vdupq_n_f32(1.0f));
+        const uint32x4_t  up  = vcgeq_f32(r, vdupq_n_f32(0.5f));
+        const uint32x4_t  dn  = vcleq_f32(r, vdupq_n_f32(-0.5f));
+        return FloatVec(
+            vsubq_f32(vaddq_f32(t, vreinterpretq_f32_u32(vandq_u32(up, one))),
+                      vreinterpretq_f32_u32(vandq_u32(dn, one))));
+#endif
+    }
+    friend inline FloatVec Pow2i(FloatVec n)
+    {
+        const float32x4_t e = vmulq_n_f32(vaddq_f32(n.v_, vdupq_n_f32(127.0f)),
+                                          8388608.0f);
+        return FloatVec(vreinterpretq_f32_s32(vcvtq_s32_f32(e)));
+    }
+    friend inline FloatVec Log2Linear(FloatVec a)
+    {
+        const float32x4_t bits = vcvtq_f32_s32(vreinterpretq_s32_f32(a.v_));
+        return FloatVec(vsubq_f32(vmulq_n_f32(bits, 1.0f / 8388608.0f),
+                                  vdupq_n_f32(127.0f)));
+    }
+    friend inline FloatVec Step(FloatVec edge, FloatVec x)
+    {
+        const uint32x4_t one = vreinterpretq_u32_f32(vdupq_n_f32(1.0f));
+        return FloatVec(vreinterpretq_f32_u32(
+            vandq_u32(vcgeq_f32(x.v_, edge.v_), one)));
+    }
+    friend inline void
+    Transpose(FloatVec &a, FloatVec &b, FloatVec &c, FloatVec &d)
+    {
+        const float32x4x2_t ab = vtrnq_f32(a.v_, b.v_);
+        const float32x4x2_t cd = vtrnq_f32(c.v_, d.v_);
+        a.v_ = vcombine_f32(vget_low_f32(ab.val[0]), vget_low_f32(cd.val[0]));
+        b.v_ = vcombine_f32(vget_low_f32(ab.val[1]), vget_low_f32(cd.val[1]));
+        c.v_ = vcombine_f32(vget_high_f32(ab.val[0]), vget_high_f32(cd.val[0]));
+        d.v_ = vcombine_f32(vget_high_f32(ab.val[1]), vget_high_f32(cd.val[1]));
+    }
+
+  private:
+    explicit FloatVec(float32x4_t v) : v_(v) {}
+    float32x4_t v_;
+#else
+    FloatVec(float x) { v_[0] = v_[1] = v_[2] = v_[3] = x; }
+    static inline FloatVec Load(const float *p)
+    {
+        FloatVec r;
+        for(size_t i = 0; i < kWidth; i++)
+            r.v_[i] = p[i];
+        return r;
+    }
+    inline void Store(float *p) const
+    {
+        for(size_t i = 0; i < kWidth; i++)
+            p[i] = v_[i];
+    }
+
+    friend inline FloatVec operator+(FloatVec a, FloatVec b)
+    {
+        for(size_t i = 0; i < kWidth; i++)
+            a.v_[i] += b.v_[i];
+        return a;
+    }
+    friend inline FloatVec operator-(FloatVec a, FloatVec b)
+    {
+        for(size_t i = 0; i < kWidth; i++)
+            a.v_[i] -= b.v_[i];
+        return a;
+    }
+    friend inline FloatVec operator*(FloatVec a, FloatVec b)
+    {
+        for(size_t i = 0; i < kWidth; i++)
+            a.v_[i] *= b.v_[i];
+        return a;
+    }
+    friend inline FloatVec operator/(FloatVec a, FloatVec b)
+    {
+        for(size_t i = 0; i < kWidth; i++)
+            a.v_[i] /= b.v_[i];
+        return a;
+    }
+    friend inline FloatVec Min(FloatVec a, FloatVec b)
+    {
+        for(size_t i = 0; i < kWidth; i++)
+            a.v_[i] = a.v_[i] < b.v_[i] ? a.v_[i] : b.v_[i];
+        return a;
+    }
+    friend inline FloatVec Max(FloatVec a, FloatVec b)
+    {
+        for(size_t i = 0; i < kWidth; i++)
+            a.v_[i] = a.v_[i] > b.v_[i] ? a.v_[i] : b.v_[i];
+        return a;
+    }
+    friend inline FloatVec Round(FloatVec a)
+    {
+        for(size_t i = 0; i < kWidth; i++)
+            a.v_[i] = simd::Round(a.v_[i]);
+        return a;
+    }
+    friend inline FloatVec Pow2i(FloatVec n)
+    {
+        for(size_t i = 0; i < kWidth; i++)
+            n.v_[i] = simd::Pow2i(n.v_[i]);
+        return n;
+    }
+    friend inline FloatVec Log2Linear(FloatVec a)
+    {
+        for(size_t i = 0; i < kWidth; i++)
+            a.v_[i] = simd::Log2Linear(a.v_[i]);
+        return a;
+    }
+    friend inline FloatVec Step(FloatVec edge, FloatVec x)
+    {
+        for(size_t i = 0; i < kWidth; i++)
+            x.v_[i] = simd::Step(edge.v_[i], x.v_[i]);
+        return x;
+    }
+    friend inline void
+    Transpose(FloatVec &a, FloatVec &b, FloatVec &c, FloatVec &d)
+    {
+        FloatVec *rows[4] = {&a, &b, &c, &d};
+        for(size_t i = 0; i < kWidth; i++)
+        {
+            for(size_t j = i + 1; j < kWidth; j++)
+            {
+                const float t  = rows[i]->v_[j];
+                rows[i]->v_[j] = rows[j]->v_[i];
+                rows[j]->v_[i] = t;
+            }
+        }
+    }
+
+  private:
+    float v_[4];
+#endif
+};
+
+template <>
+class FloatVec<8>
+{
+  public:
+    static constexpr size_t kWidth = 8;
+
+    FloatVec() {}
+
+#if defined(DSY_SIMD_AVX)
+    FloatVec(float x) : v_(_mm256_set1_ps(x)) {}
+    static inline FloatVec Load(const float *p)
+    {
+        return FloatVec(_mm256_loadu_ps(p));
+    }
+    inline void Store(float *p) const { _mm256_storeu_ps(p, v_); }
+
+    friend inline FloatVec operator+(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm256_add_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec operator-(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm256_sub_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec operator*(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm256_mul_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec operator/(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm256_div_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec Min(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm256_min_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec Max(FloatVec a, FloatVec b)
+    {
+        return FloatVec(_mm256_max_ps(a.v_, b.v_));
+    }
+    friend inline FloatVec Round(FloatVec a)
+    {
+        return FloatVec(_mm256_round_ps(
+            a.v_, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    }
+    friend inline FloatVec Pow2i(FloatVec n)
+    {
+        const __m256 e = _mm256_mul_ps(
+            _mm256_add_ps(n.v_, _mm256_set1_ps(127.0f)),
+            _mm256_set1_ps(8388608.0f));
+        return FloatVec(_mm256_castsi256_ps(_mm256_cvtps_epi32(e)));
+    }
+    friend inline FloatVec Log2Linear(FloatVec a)
+    {
+        const __m256 bits  = _mm256_cvtepi32_ps(_mm256_castps_si256(a.v_));
+        const __m256 scale = _mm256_set1_ps(1.0f / 8388608.0f);
+        return FloatVec(
+            _mm256_sub_ps(_mm256_mul_ps(bits, scale), _mm256_set1_ps(127.0f)));
+    }
+    friend inline FloatVec Step(FloatVec edge, FloatVec x)
+    {
+        return FloatVec(_mm256_and_ps(_mm256_cmp_ps(x.v_, edge.v_, _CMP_GE_OQ),
+                                      _mm256_set1_ps(1.0f)));
+    }
+
+  private:
+    explicit FloatVec(__m256 v) : v_(v) {}
+    __m256 v_;
+#else
+    // Two 4 lane halves where 8 lane registers are not available
+    FloatVec(float x) : lo_(x), hi_(x) {}
+    static inline FloatVec Load(const float *p)
+    {
+        return FloatVec(FloatVec<4>::Load(p), FloatVec<4>::Load(p + 4));
+    }
+    inline void Store(float *p) const
+    {
+        lo_.Store(p);
+        hi_.Store(p + 4);
+    }
+
+    friend inline FloatVec operator+(FloatVec a, FloatVec b)
+    {
+        return FloatVec(a.lo_ + b.lo_, a.hi_ + b.hi_);
+    }
+    friend inline FloatVec operator-(FloatVec a, FloatVec b)
+    {
+        return FloatVec(a.lo_ - b.lo_, a.hi_ - b.hi_);
+    }
+    friend inline FloatVec operator*(FloatVec a, FloatVec b)
+    {
+        return FloatVec(a.lo_ * b.lo_, a.hi_ * b.hi_);
+    }
+    friend inline FloatVec operator/(FloatVec a, FloatVec b)
+    {
+        return FloatVec(a.lo_ / b.lo_, a.hi_ / b.hi_);
+    }
+    friend inline FloatVec Min(FloatVec a, FloatVec b)
+    {
+        return FloatVec(Min(a.lo_, b.lo_), Min(a.hi_, b.hi_));
+    }
+    friend inline FloatVec Max(FloatVec a, FloatVec b)
+    {
+        return FloatVec(Max(a.lo_, b.lo_), Max(a.hi_, b.hi_));
+    }
+    friend inline FloatVec Round(FloatVec a)
+    {
+        return FloatVec(Round(a.lo_), Round(a.hi_));
+    }
+    friend inline FloatVec Pow2i(FloatVec n)
+    {
+        return FloatVec(Pow2i(n.lo_), Pow2i(n.hi_));
+    }
+    friend inline FloatVec Log2Linear(FloatVec a)
+    {
+        return FloatVec(Log2Linear(a.lo_), Log2Linear(a.hi_));
+    }
+    friend inline FloatVec Step(FloatVec edge, FloatVec x)
+    {
+        return FloatVec(Step(edge.lo_, x.lo_), Step(edge.hi_, x.hi_));
+    }
+
+  private:
+    FloatVec(FloatVec<4> lo, FloatVec<4> hi) : lo_(lo), hi_(hi) {}
+    FloatVec<4> lo_, hi_;
+#endif
+};
+
+} // namespace simd
+} // namespace daisysp
+#endif
+#endif
@@ -3,6 +3,7 @@
 #define DSY_SMOOTHRANDOM_H
 
 #include "dsp.h"
+#include "random.h"
 #include <stdint.h>
 #include <stdlib.h>
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ class SmoothRandomGenerator
     void Init(float sample_rate)
     {
         sample_rate_ = sample_rate;
+        rng_.Reset();
 
         SetFreq(1.f);
         phase_    = 0.0f;
@@ -46,7 +48,7 @@ class SmoothRandomGenerator
         {
             phase_ -= 1.0f;
             from_ += interval_;
-            interval_ = rand() * kRandFrac * 2.0f - 1.0f - from_;
+            interval_ = rng_.NextBipolar() - from_;
         }
         float t = phase_ * phase_ * (3.0f - 2.0f * phase_);
         return from_ + interval_ * t;
@@ -61,6 +63,9 @@ class SmoothRandomGenerator
         frequency_ = fclamp(freq, 0.f, 1.f);
     }
 
+    /** Seeds the noise, see Random::SetSeed() */
+    void SetSeed(uint32_t seed) { rng_.SetSeed(seed); }
+
   private:
     float frequency_;
     float phase_;
@@ -69,7 +74,7 @@ class SmoothRandomGenerator
 
     float sample_rate_;
 
-    static constexpr float kRandFrac = 1.f / (float)RAND_MAX;
+    Random rng_;
 };
 
 } // namespace daisysp
@@ -0,0 +1,280 @@
+#pragma once
+#ifndef DSY_VOICESCHEDULER_H
+#define DSY_VOICESCHEDULER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#ifdef __cplusplus
+#include <atomic>
+#include <thread>
+
+/** @file voicescheduler.h */
+
+namespace daisysp
+{
+/** Renders independent voices on a fixed set of worker threads.
+
+    Each call to Process() is one round: the calling thread releases the
+    workers, every thread takes voices from a shared atomic index until
+    none are left, and the calling thread waits for the workers before
+    it sums the voices. Threads that finish early take the voices others
+    have not reached yet, so uneven voices still balance out. The sum is
+    always taken in the order the voices were added, so the output does
+    not depend on which thread rendered what.
+
+    Process() takes no locks and does not allocate. Waiting threads spin
+    and then yield, they are never put to sleep, so the workers keep
+    their cores busy between blocks. That is the trade for a wake-up
+    that costs no system call.
+
+    This needs std::thread, so it is meant for hosted builds and is not
+    included by daisysp.h.
+
+    \code
+    StringVoice        voices[32];
+    VoiceScheduler<32> scheduler;
+    for(size_t i = 0; i < 32; i++)
+    {
+        voices[i].Init(sample_rate);
+        scheduler.AddVoice(voices[i]);
+    }
+    scheduler.Init(4); // the calling thread and 3 workers
+    scheduler.Process(out, size);
+    \endcode
+
+    Voice parameters may be changed between calls to Process(). Voices
+    must not be added while Process() runs.
+
+    \param max_voices - maximum number of voices
+    \param max_threads - maximum number of threads, including the caller
+    \param max_block - internal block size, longer blocks are split
+*/
+template <size_t max_voices, size_t max_threads = 8, size_t max_block = 48>
+class VoiceScheduler
+{
+  public:
+    /** Renders size samples of one voice into out */
+    typedef void (*RenderFn)(void *voice, float *out, size_t size);
+
+    VoiceScheduler()
+    : num_voices_(0),
+      num_workers_(0),
+      size_(0),
+      running_(false),
+      generation_(0),
+      next_(0),
+      finished_(0)
+    {
+    }
+    ~VoiceScheduler() { Stop(); }
+
+    /** Starts the worker threads. Voices can be added before or after.
+        \param num_threads - threads rendering voices, including the one
+        calling Process(). 1 renders everything on the calling thread.
+        \return false if num_threads is out of range
+    */
+    bool Init(size_t num_threads)
+    {
+        if(num_threads < 1 || num_threads > max_threads)
+            return false;
+        Stop();
+        running_.store(true, std::memory_order_relaxed);
+        generation_.store(0, std::memory_order_relaxed);
+        num_workers_ = num_threads - 1;
+        for(size_t i = 0; i < num_workers_; i++)
+        {
+            workers_[i] = std::thread(&VoiceScheduler::WorkerLoop, this);
+        }
+        return true;
+    }
+
+    /** Stops and joins the worker threads */
+    void Stop()
+    {
+        if(num_workers_ == 0)
+            return;
+        running_.store(false, std::memory_order_relaxed);
+        generation_.fetch_add(1, std::memory_order_release);
+        for(size_t i = 0; i < num_workers_; i++)
+        {
+            workers_[i].join();
+        }
+        num_workers_ = 0;
+    }
+
+    /** Adds a voice
+        \param voice - passed to render, must outlive the scheduler
+        \param render - renders the voice, called from any of the threads
+        \return false if max_voices voices were already added
+    */
+    bool AddVoice(void *voice, RenderFn render)
+    {
+        if(num_voices_ >= max_voices)
+            return false;
+        voices_[num_voices_].voice  = voice;
+        voices_[num_voices_].render = render;
+        num_voices_++;
+        return true;
+    }
+
+    /** Adds a voice with a float Process() method, like StringVoice or
+        ModalVoice
+    */
+    template <typename Voice>
+    bool AddVoice(Voice &voice)
+    {
+        return AddVoice(&voice, &RenderVoice<Voice>);
+    }
+
+    /** Removes all voices */
+    void ClearVoices() { num_voices_ = 0; }
+
+    /** Renders all voices and writes their sum
+        \param out - output buffer
+        \param size - number of samples
+    */
+    void Process(float *out, size_t size)
+    {
+        while(size > 0)
+        {
+            const size_t todo = size < max_block ? size : max_block;
+            RenderBlock(todo);
+            Sum(out, todo);
+            out += todo;
+            size -= todo;
+        }
+    }
+
+    /** Output of one voice from the last internal block of Process(),
+        up to max_block samples
+    */
+    const float *GetVoiceOutput(size_t voice) const
+    {
+        return buffers_[voice];
+    }
+
+    /** Returns the number of voices */
+    size_t GetNumVoices() const { return num_voices_; }
+
+    /** Returns the number of threads, including the calling thread */
+    size_t GetNumThreads() const { return num_workers_ + 1; }
+
+  private:
+    // Spins before a waiting thread starts yielding its time slice
+    static constexpr int kSpinCount = 1000;
+    // Keeps the atomics written by different threads on their own lines
+    static constexpr size_t kCacheLine = 64;
+
+    struct VoiceSlot
+    {
+        void *   voice;
+        RenderFn render;
+    };
+
+    template <typename Voice>
+    static void RenderVoice(void *voice, float *out, size_t size)
+    {
+        Voice &v = *static_cast<Voice *>(voice);
+        for(size_t i = 0; i < size; i++)
+        {
+            out[i] = v.Process();
+        }
+    }
+
+    void RenderBlock(size_t size)
+    {
+        size_ = size;
+        next_.store(0, std::memory_order_relaxed);
+        finished_.store(0, std::memory_order_relaxed);
+        if(num_workers_ > 0)
+        {
+            generation_.fetch_add(1, std::memory_order_release);
+        }
+
+        RenderVoices();
+
+        int spins = 0;
+        while(finished_.load(std::memory_order_acquire) < num_workers_)
+        {
+            Wait(spins);
+        }
+    }
+
+    void RenderVoices()
+    {
+        const size_t size = size_;
+        size_t       v;
+        while((v = next_.fetch_add(1, std::memory_order_relaxed))
+              < num_voices_)
+        {
+            voices_[v].render(voices_[v].voice, buffers_[v], size);
+        }
+    }
+
+    void Sum(float *out, size_t size) const
+    {
+        if(num_voices_ == 0)
+        {
+            memset(out, 0, size * sizeof(float));
+            return;
+        }
+        memcpy(out, buffers_[0], size * sizeof(float));
+        for(size_t v = 1; v < num_voices_; v++)
+        {
+            const float *buf = buffers_[v];
+            for(size_t i = 0; i < size; i++)
+            {
+                out[i] += buf[i];
+            }
+        }
+    }
+
+    void WorkerLoop()
+    {
+        // Init() set the generation to 0 before starting the thread
+        uint32_t seen = 0;
+        while(true)
+        {
+            int      spins = 0;
+            uint32_t generation;
+            while((generation = generation_.load(std::memory_order_acquire))
+                  == seen)
+            {
+                Wait(spins);
+            }
+            seen = generation;
+            if(!running_.load(std::memory_order_relaxed))
+                return;
+            RenderVoices();
+            finished_.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    static inline void Wait(int &spins)
+    {
+        if(spins < kSpinCount)
+            spins++;
+        else
+            std::this_thread::yield();
+    }
+
+    VoiceSlot   voices_[max_voices];
+    float       buffers_[max_voices][max_block];
+    size_t      num_voices_;
+    size_t      num_workers_;
+    size_t      size_;
+    std::thread workers_[max_threads > 1 ? max_threads - 1 : 1];
+
+    std::atomic<bool>     running_;
+    char                  pad0_[kCacheLine];
+    std::atomic<uint32_t> generation_;
+    char                  pad1_[kCacheLine];
+    std::atomic<size_t>   next_;
+    char                  pad2_[kCacheLine];
+    std::atomic<size_t>   finished_;
+    char                  pad3_[kCacheLine];
+};
+} // namespace daisysp
+#endif
+#endif
@@ -9,6 +9,7 @@
 //        - in cases of potentially large memory usage: the user will either supply a buffer and a size, or the class will be a template that can have size set at compile time.
 //        - all modules will have an Init() function, and a Process() function.
 //        - all modules, unless otherwise noted, will process a single sample at a time.
+//        - most modules additionally offer ProcessBlock(in, out, size) (effects, filters) or Render(out, size) (generators, envelopes).
 //        - all processing will be done with 'float' type unless otherwise noted.
 //
 #pragma once
@@ -29,6 +30,7 @@
 /** Drum Modules */
 #include "Drums/analogbassdrum.h"
 #include "Drums/analogsnaredrum.h"
+#include "Drums/drumbank.h"
 #include "Drums/hihat.h"
 #include "Drums/synthbassdrum.h"
 #include "Drums/synthsnaredrum.h"
@@ -44,6 +46,7 @@
 #include "Effects/bitcrush.h"
 #include "Effects/chorus.h"
 #include "Effects/decimator.h"
+#include "Effects/fdnreverb.h"
 #include "Effects/flanger.h"
 #include "Effects/fold.h"
 #include "Effects/overdrive.h"
@@ -64,8 +67,11 @@
 #include "Filters/nlfilt.h"
 #include "Filters/svf.h"
 #include "Filters/svf_legacy.h"
+#include "Filters/svfbank.h"
 #include "Filters/tone.h"
 #include "Filters/fir.h"
+#include "Filters/fastconv.h"
+#include "Filters/polyphase.h"
 
 /** Noise Modules */
 #include "Noise/clockednoise.h"
@@ -92,6 +98,7 @@
 #include "Synthesis/formantosc.h"
 #include "Synthesis/harmonic_osc.h"
 #include "Synthesis/oscillator.h"
+#include "Synthesis/oscillatorarray.h"
 #include "Synthesis/oscillatorbank.h"
 #include "Synthesis/variablesawosc.h"
 #include "Synthesis/variableshapeosc.h"
@@ -100,17 +107,26 @@
 #include "Synthesis/sine.h"
 
 /** Utility Modules */
+#include "Utility/arena.h"
 #include "Utility/dcblock.h"
 #include "Utility/delayline.h"
 #include "Utility/dsp.h"
+#include "Utility/eventlist.h"
+#include "Utility/fft.h"
 #include "Utility/jitter.h"
+#include "Utility/lut.h"
 #include "Utility/looper.h"
 #include "Utility/maytrig.h"
 #include "Utility/metro.h"
+#include "Utility/oversampled.h"
 #include "Utility/port.h"
+#include "Utility/random.h"
+#include "Utility/resampler.h"
 #include "Utility/pattern_predictor.h"
 #include "Utility/parameter_interpolator.h"
+#include "Utility/parameter_queue.h"
 #include "Utility/samplehold.h"
+#include "Utility/simd.h"
 #include "Utility/smooth_random.h"
 
 #endif
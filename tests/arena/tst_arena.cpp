@@ -0,0 +1,289 @@
+#include "daisysp.h"
+#include "test_util.h"
+
+#if defined(_WIN32)
+#include <thread>
+#endif
+
+/**   @brief Arena and Pool allocator unit tests
+ */
+
+using namespace daisysp;
+using namespace daisy;
+
+
+/** Test platform choice, DaisySeed, DaisyPod and DaisyPC are currently supported
+ ** If compiled for a PC target, all platforms would automagically turn into
+ ** DaisyPC */
+using TestPlatform = DsyTestHelper<DaisyPod>;
+static TestPlatform hw;
+
+
+static constexpr size_t MEMORY_SIZE = 64 * 1024;
+static constexpr size_t NUM_THREADS = 4;
+
+/* Memory to allocate from, offset by one byte so alignment is not free */
+static uint8_t DSY_SDRAM_BSS memory[MEMORY_SIZE + 64];
+static uint8_t* const buffer = memory + 1;
+
+static bool IsAligned(const void* p, size_t align)
+{
+    return reinterpret_cast<uintptr_t>(p) % align == 0;
+}
+
+static bool IsInside(const void* p, size_t size)
+{
+    const uint8_t* b = static_cast<const uint8_t*>(p);
+    return b >= buffer && b + size <= buffer + MEMORY_SIZE;
+}
+
+/** Allocations of every alignment are aligned, inside the buffer and in
+ ** increasing order, so they cannot overlap */
+static bool arena_alignment()
+{
+    static const size_t aligns[] = {1, 2, 4, 8, 16, 32, 64};
+
+    Arena arena;
+    arena.Init(buffer, MEMORY_SIZE);
+
+    bool           pass = true;
+    const uint8_t* end  = buffer;
+    for(size_t i = 0; i < 200; i++)
+    {
+        const size_t align = aligns[i % DSY_COUNTOF(aligns)];
+        const size_t size  = 1 + (i * 7) % 45;
+        uint8_t*     p = static_cast<uint8_t*>(arena.Allocate(size, align));
+        pass &= p != nullptr && IsAligned(p, align) && IsInside(p, size);
+        pass &= p >= end;
+        end = p + size;
+    }
+    pass &= arena.GetUsed() == static_cast<size_t>(end - buffer);
+
+    double* d = arena.Allocate<double>(3);
+    pass &= d != nullptr && IsAligned(d, alignof(double));
+    return pass;
+}
+
+/** A full arena returns nullptr and stays usable, Reset() starts over */
+static bool arena_exhaustion()
+{
+    Arena arena;
+    arena.Init(buffer, MEMORY_SIZE);
+
+    bool   pass  = true;
+    size_t count = 0;
+    while(arena.Allocate(1000, 1) != nullptr)
+    {
+        count++;
+    }
+    pass &= count == MEMORY_SIZE / 1000;
+    pass &= arena.GetUsed() == count * 1000;
+
+    /* what is left still fits */
+    const size_t left = MEMORY_SIZE - arena.GetUsed();
+    pass &= arena.Allocate(left, 1) != nullptr;
+    pass &= arena.Allocate(1, 1) == nullptr;
+    pass &= arena.GetHighWaterMark() == MEMORY_SIZE;
+
+    arena.Reset();
+    pass &= arena.GetUsed() == 0;
+    pass &= arena.Allocate(10, 1) == buffer;
+    pass &= arena.GetHighWaterMark() == MEMORY_SIZE;
+    arena.ResetHighWaterMark();
+    pass &= arena.GetHighWaterMark() == 10;
+    return pass;
+}
+
+/** Element counts whose size in bytes overflows size_t are refused */
+static bool arena_overflow()
+{
+    Arena arena;
+    arena.Init(buffer, MEMORY_SIZE);
+    arena.Allocate(16, 1);
+
+    bool pass = true;
+    pass &= arena.Allocate<double>(SIZE_MAX / sizeof(double) + 1) == nullptr;
+    pass &= arena.Allocate<float>(SIZE_MAX / 2) == nullptr;
+    pass &= arena.Allocate<uint8_t>(SIZE_MAX) == nullptr;
+    pass &= arena.Allocate(SIZE_MAX, 1) == nullptr;
+    pass &= arena.GetUsed() == 16;
+    return pass;
+}
+
+/** Pool blocks are aligned, distinct and reused after Free() */
+static bool pool_blocks()
+{
+    static uint8_t* blocks[MEMORY_SIZE / 32];
+
+    /* a block takes 32 bytes, plus 4 for its free list link */
+
+    Pool pool;
+    pool.Init(buffer, MEMORY_SIZE, 24, 32);
+
+    bool         pass = pool.GetBlockSize() == 32;
+    const size_t n    = pool.GetNumBlocks();
+    pass &= n >= (MEMORY_SIZE - 31 - 3) / 36 && n <= MEMORY_SIZE / 36;
+    for(size_t i = 0; i < n; i++)
+    {
+        blocks[i] = static_cast<uint8_t*>(pool.Allocate());
+        pass &= blocks[i] != nullptr && IsAligned(blocks[i], 32)
+                && IsInside(blocks[i], 32);
+        pass &= i == 0 || blocks[i] >= blocks[i - 1] + 32;
+    }
+    pass &= pool.Allocate() == nullptr;
+    pass &= pool.GetInUse() == n && pool.GetHighWaterMark() == n;
+
+    /* freed blocks come back, last in first out */
+    pool.Free(blocks[3]);
+    pool.Free(blocks[7]);
+    pass &= pool.GetInUse() == n - 2;
+    pass &= pool.Allocate() == blocks[7];
+    pass &= pool.Allocate() == blocks[3];
+    pass &= pool.Allocate() == nullptr;
+
+    pool.Reset();
+    pass &= pool.GetInUse() == 0 && pool.Allocate() == blocks[0];
+    return pass;
+}
+
+#if defined(_WIN32)
+/** Threads allocate from one arena at once, no two allocations overlap */
+static bool arena_concurrent()
+{
+    static constexpr size_t kPerThread = 1000;
+    static uint8_t*         got[NUM_THREADS][kPerThread];
+
+    Arena arena;
+    arena.Init(buffer, MEMORY_SIZE);
+
+    std::thread threads[NUM_THREADS];
+    for(size_t t = 0; t < NUM_THREADS; t++)
+    {
+        threads[t] = std::thread([&arena, t]() {
+            for(size_t i = 0; i < kPerThread; i++)
+            {
+                got[t][i] = static_cast<uint8_t*>(arena.Allocate(12, 4));
+                if(got[t][i] != nullptr)
+                    memset(got[t][i], static_cast<int>(t + 1), 12);
+            }
+        });
+    }
+    for(size_t t = 0; t < NUM_THREADS; t++)
+    {
+        threads[t].join();
+    }
+
+    /* every allocation still holds its own thread's bytes */
+    bool   pass  = true;
+    size_t count = 0;
+    for(size_t t = 0; t < NUM_THREADS; t++)
+    {
+        for(size_t i = 0; i < kPerThread; i++)
+        {
+            if(got[t][i] == nullptr)
+                continue;
+            count++;
+            for(size_t k = 0; k < 12; k++)
+            {
+                pass &= got[t][i][k] == t + 1;
+            }
+        }
+    }
+    pass &= count == DSY_MIN(NUM_THREADS * kPerThread, MEMORY_SIZE / 12);
+    pass &= arena.GetUsed() <= MEMORY_SIZE;
+    return pass;
+}
+
+/** Threads allocate and free blocks of one small pool at once. A block is
+ ** never handed to two threads at a time, and all come back in the end */
+static bool pool_concurrent()
+{
+    static constexpr size_t kBlocks = 16;
+    static constexpr size_t kRounds = 20000;
+
+    Pool pool;
+    pool.Init(buffer, kBlocks * (64 + 4) + 63 + 3, 64, 64);
+
+    std::atomic<bool> pass(pool.GetNumBlocks() == kBlocks);
+    std::thread       threads[NUM_THREADS];
+    for(size_t t = 0; t < NUM_THREADS; t++)
+    {
+        threads[t] = std::thread([&pool, &pass, t]() {
+            uint8_t* held[3];
+            for(size_t r = 0; r < kRounds; r++)
+            {
+                for(size_t k = 0; k < 3; k++)
+                {
+                    held[k] = static_cast<uint8_t*>(pool.Allocate());
+                    if(held[k] != nullptr)
+                        memset(held[k], static_cast<int>(t + 1), 64);
+                }
+                for(size_t k = 0; k < 3; k++)
+                {
+                    if(held[k] == nullptr)
+                        continue;
+                    for(size_t i = 0; i < 64; i++)
+                    {
+                        if(held[k][i] != t + 1)
+                            pass = false;
+                    }
+                    pool.Free(held[k]);
+                }
+            }
+        });
+    }
+    for(size_t t = 0; t < NUM_THREADS; t++)
+    {
+        threads[t].join();
+    }
+
+    /* all blocks are back on the free list */
+    bool result = pass && pool.GetInUse() == 0;
+    for(size_t i = 0; i < kBlocks; i++)
+    {
+        result &= pool.Allocate() != nullptr;
+    }
+    result &= pool.Allocate() == nullptr;
+    return result;
+}
+#endif
+
+struct ArenaCase
+{
+    const char* name;
+    bool (*test)();
+};
+
+static const ArenaCase case_list[] = {
+    {"Arena alignment", arena_alignment},
+    {"Arena exhaustion", arena_exhaustion},
+    {"Arena overflow", arena_overflow},
+    {"Pool blocks", pool_blocks},
+#if defined(_WIN32)
+    /* the Daisy targets have no threads */
+    {"Arena threads", arena_concurrent},
+    {"Pool threads", pool_concurrent},
+#endif
+};
+
+
+int main(void)
+{
+    /* Initialize hardware */
+    hw.Prepare();
+
+    /* Print header */
+    hw.PrintLine("Case              | Check");
+
+    bool result = true;
+    for(size_t i = 0; i < DSY_COUNTOF(case_list); i++)
+    {
+        const bool pass = case_list[i].test();
+        hw.PrintLine("%-18s| %s", case_list[i].name, hw.ResultStr(pass));
+        result &= pass;
+    }
+
+    /* Display the result */
+    hw.Finish(result);
+    return result ? 0 : -1;
+}
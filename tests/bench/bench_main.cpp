@@ -0,0 +1,142 @@
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bench_util.h"
+
+/**   @brief Command line driver for the DaisySP host benchmarks
+ *
+ *    Usage: daisysp_bench [options]
+ *      --rates 44100,48000,96000   sample rates to measure
+ *      --blocks 1,16,48,256        block sizes to measure
+ *      --seconds 2.0               seconds of audio per measurement
+ *      --filter Svf                only run cases whose name contains "Svf"
+ *      --json results.json         write machine-readable results
+ *      --list                      print the registered cases and exit
+ *      --quick                     short smoke run (used by ctest)
+ */
+
+using namespace daisysp::bench;
+
+namespace
+{
+template <typename T>
+std::vector<T> ParseList(const char* arg)
+{
+    std::vector<T> list;
+    std::string    s(arg);
+    size_t         pos = 0;
+    while(pos < s.size())
+    {
+        size_t next = s.find(',', pos);
+        if(next == std::string::npos)
+        {
+            next = s.size();
+        }
+        list.push_back(static_cast<T>(atof(s.substr(pos, next - pos).c_str())));
+        pos = next + 1;
+    }
+    return list;
+}
+
+void PrintUsage(const char* exe)
+{
+    printf("usage: %s [--rates a,b] [--blocks a,b] [--seconds s] "
+           "[--filter name] [--json file] [--list] [--quick]\n",
+           exe);
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    BenchConfig cfg;
+    cfg.sample_rates = {44100.f, 48000.f, 96000.f};
+    cfg.block_sizes  = {1, 16, 48, 256};
+    cfg.seconds      = 2.f;
+    cfg.warmup       = 0.1f;
+
+    bool list_only = false;
+    for(int i = 1; i < argc; i++)
+    {
+        const bool has_value = i + 1 < argc;
+        if(0 == strcmp(argv[i], "--rates") && has_value)
+        {
+            cfg.sample_rates = ParseList<float>(argv[++i]);
+        }
+        else if(0 == strcmp(argv[i], "--blocks") && has_value)
+        {
+            cfg.block_sizes = ParseList<size_t>(argv[++i]);
+        }
+        else if(0 == strcmp(argv[i], "--seconds") && has_value)
+        {
+            cfg.seconds = static_cast<float>(atof(argv[++i]));
+        }
+        else if(0 == strcmp(argv[i], "--filter") && has_value)
+        {
+            cfg.filter = argv[++i];
+        }
+        else if(0 == strcmp(argv[i], "--json") && has_value)
+        {
+            cfg.json_path = argv[++i];
+        }
+        else if(0 == strcmp(argv[i], "--list"))
+        {
+            list_only = true;
+        }
+        else if(0 == strcmp(argv[i], "--quick"))
+        {
+            cfg.sample_rates = {48000.f};
+            cfg.block_sizes  = {1, 48};
+            cfg.seconds      = 0.05f;
+            cfg.warmup       = 0.f;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    BenchRegistry reg;
+    RegisterModules(reg);
+
+    if(list_only)
+    {
+        for(const BenchCase& c : reg.Cases())
+        {
+            printf("%s\n", c.name.c_str());
+        }
+        return 0;
+    }
+
+    std::vector<BenchResult> results;
+    PrintHeader();
+    for(const BenchCase& c : reg.Cases())
+    {
+        if(!cfg.filter.empty() && c.name.find(cfg.filter) == std::string::npos)
+        {
+            continue;
+        }
+        for(float sr : cfg.sample_rates)
+        {
+            for(size_t block : cfg.block_sizes)
+            {
+                if(block == 0)
+                {
+                    continue;
+                }
+                results.push_back(Measure(c, sr, block, cfg));
+                PrintResult(results.back());
+            }
+        }
+    }
+
+    if(!cfg.json_path.empty() && !WriteJson(cfg.json_path, cfg, results))
+    {
+        fprintf(stderr, "failed to write %s\n", cfg.json_path.c_str());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,1524 @@
+#include "daisysp.h"
+#include "Utility/voicescheduler.h"
+#include "bench_util.h"
+
+/**   @brief Benchmark cases for every module exported by daisysp.h
+ *
+ *    Modules are grouped the same way as in daisysp.h. Parameters are set
+ *    to typical musical values; triggered modules are re-triggered every
+ *    250 ms through BenchContext::Trigger().
+ */
+
+using namespace daisysp;
+using namespace daisysp::bench;
+
+namespace
+{
+/* Module with float Process(float in) (or float Process(float& in)) */
+template <typename T, typename InitFn>
+void AddEffect(BenchRegistry& reg, const char* name, InitFn init)
+{
+    reg.Add<T>(name,
+               init,
+               [](T& m, BenchContext&, const float* in, float* out, size_t n) {
+                   for(size_t i = 0; i < n; i++)
+                   {
+                       float x = in[i];
+                       out[i]  = m.Process(x);
+                   }
+               });
+}
+
+/* Module with float Process() */
+template <typename T, typename InitFn>
+void AddGenerator(BenchRegistry& reg, const char* name, InitFn init)
+{
+    reg.Add<T>(name,
+               init,
+               [](T& m, BenchContext&, const float*, float* out, size_t n) {
+                   for(size_t i = 0; i < n; i++)
+                   {
+                       out[i] = m.Process();
+                   }
+               });
+}
+
+/* Module with void ProcessBlock(const float* in, float* out, size_t size) */
+template <typename T, typename InitFn>
+void AddBlockEffect(BenchRegistry& reg, const char* name, InitFn init)
+{
+    reg.Add<T>(name,
+               init,
+               [](T& m, BenchContext&, const float* in, float* out, size_t n) {
+                   m.ProcessBlock(in, out, n);
+               });
+}
+
+/* Module with void Render(float* out, size_t size) */
+template <typename T, typename InitFn>
+void AddBlockGenerator(BenchRegistry& reg, const char* name, InitFn init)
+{
+    reg.Add<T>(name,
+               init,
+               [](T& m, BenchContext&, const float*, float* out, size_t n) {
+                   m.Render(out, n);
+               });
+}
+
+/* Module with void Render(bool trigger, float* out, size_t size), triggered
+   at the start of a block when any of its samples would have triggered */
+template <typename T, typename InitFn>
+void AddBlockTriggered(BenchRegistry& reg, const char* name, InitFn init)
+{
+    reg.Add<T>(name,
+               init,
+               [](T& m, BenchContext& ctx, const float*, float* out, size_t n) {
+                   bool trigger = false;
+                   for(size_t i = 0; i < n; i++)
+                   {
+                       trigger |= ctx.Trigger();
+                   }
+                   m.Render(trigger, out, n);
+               });
+}
+
+/* Module with void Render(bool trigger, float* out, size_t size), triggered
+   at the exact samples through an EventList */
+template <typename T>
+struct WithEvents
+{
+    T             module;
+    EventList<16> events;
+};
+
+template <typename T, typename InitFn>
+void AddEventTriggered(BenchRegistry& reg, const char* name, InitFn init)
+{
+    reg.Add<WithEvents<T>>(
+        name,
+        [init](WithEvents<T>& m, float sr) {
+            init(m.module, sr);
+            m.events.Clear();
+        },
+        [](WithEvents<T>& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                if(ctx.Trigger())
+                    m.events.Add(i);
+            }
+            RenderTriggered(m.module, m.events, out, n);
+            m.events.Advance(n);
+        });
+}
+
+/* Module with float Process(bool trigger) */
+template <typename T, typename InitFn>
+void AddTriggered(BenchRegistry& reg, const char* name, InitFn init)
+{
+    reg.Add<T>(name,
+               init,
+               [](T& m, BenchContext& ctx, const float*, float* out, size_t n) {
+                   for(size_t i = 0; i < n; i++)
+                   {
+                       out[i] = m.Process(ctx.Trigger());
+                   }
+               });
+}
+
+/* Module with void Trigger(...) and float Process() */
+template <typename T, typename InitFn, typename TrigFn>
+void AddEnvelope(BenchRegistry& reg, const char* name, InitFn init, TrigFn)
+{
+    reg.Add<T>(name,
+               init,
+               [](T& m, BenchContext& ctx, const float*, float* out, size_t n) {
+                   for(size_t i = 0; i < n; i++)
+                   {
+                       if(ctx.Trigger())
+                       {
+                           TrigFn()(m);
+                       }
+                       out[i] = m.Process();
+                   }
+               });
+}
+
+/* Trigger functors for AddEnvelope */
+struct TrigHard
+{
+    template <typename T>
+    void operator()(T& m)
+    {
+        m.Trigger(true);
+    }
+};
+
+struct TrigPlain
+{
+    template <typename T>
+    void operator()(T& m)
+    {
+        m.Trigger();
+    }
+};
+
+/* Modules that need external memory carry it alongside */
+template <typename T, size_t size>
+struct WithBuffer
+{
+    T     module;
+    float buffer[size];
+};
+
+static constexpr size_t kCombSize   = 9600;
+static constexpr size_t kPluckSize  = 256;
+static constexpr size_t kLooperSize = 48000 * 4;
+static constexpr size_t kFirTaps    = 64;
+static constexpr size_t kFirBlock   = 1024;
+
+using BufferedAllpass = WithBuffer<Allpass, kCombSize>;
+using BufferedComb    = WithBuffer<Comb, kCombSize>;
+using BufferedPluck   = WithBuffer<Pluck, kPluckSize>;
+using BufferedMSM     = WithBuffer<MSM_Pluck, kPluckSize>;
+using BufferedLooper  = WithBuffer<Looper, kLooperSize>;
+
+/* Nonlinear modules running at 4x the sample rate */
+using MoogLadderX4 = Oversampled<MoogLadder, 4>;
+using OverdriveX4  = Oversampled<Overdrive, 4>;
+
+/* Resampler fed with as much input as it takes to fill the output block */
+template <size_t zero_crossings>
+void AddResampler(BenchRegistry& reg, const char* name, float ratio)
+{
+    using T = Resampler<zero_crossings>;
+    reg.Add<T>(
+        name,
+        [ratio](T& m, float) { m.Init(ratio); },
+        [](T& m, BenchContext&, const float* in, float* out, size_t n) {
+            m.Process(in, n, out, n, nullptr);
+        });
+}
+
+/* Varispeed playback, speed swept between 0.5 and 1.5 once per block */
+struct Varispeed
+{
+    Resampler<16> resampler;
+    float         phase;
+};
+
+/* Long (cabinet style) impulse responses */
+static constexpr size_t kLongTaps = 4096;
+
+using FastConvLong = FastConv<kLongTaps, 64>;
+
+/* Decaying noise impulse response, natural order */
+void MakeIR(float* ir, size_t size)
+{
+    uint32_t seed = 1u;
+    float    env  = 1.f;
+    for(size_t i = 0; i < size; i++)
+    {
+        seed  = seed * 1664525u + 1013904223u;
+        ir[i] = env * static_cast<int32_t>(seed) * (0.1f / 2147483648.f);
+        env *= 0.999f;
+    }
+}
+
+/* FIR implementation T of the given length, processed in kFirBlock chunks */
+template <typename T, size_t taps>
+void AddFir(BenchRegistry& reg, const char* name)
+{
+    reg.Add<T>(
+        name,
+        [](T& m, float) {
+            static float ir[taps];
+            MakeIR(ir, taps);
+            m.SetIR(ir, taps, true);
+        },
+        [](T& m, BenchContext&, const float* in, float* out, size_t n) {
+            while(n > 0)
+            {
+                const size_t block = n < kFirBlock ? n : kFirBlock;
+                m.ProcessBlock(in, out, block);
+                in += block;
+                out += block;
+                n -= block;
+            }
+        });
+}
+
+/* Polyphonic filtering: kVoices independent filters fed with the same input.
+   One benchmark sample is one frame of kVoices voices. */
+static constexpr size_t kVoices     = 32;
+static constexpr size_t kFrameChunk = 64;
+
+struct SvfVoices
+{
+    Svf voice[kVoices];
+};
+
+struct SvfBankFrames
+{
+    SvfBank<kVoices> bank;
+    float            in[kFrameChunk * kVoices];
+    float            low[kFrameChunk * kVoices];
+};
+
+/* Chorus sized delay line, with and without power of two masking */
+static constexpr size_t kChorusDelay = 2400;
+using ChorusDelayPow2                = DelayLine<float, kChorusDelay, true>;
+
+template <typename T>
+void AddDelayLine(BenchRegistry& reg, const char* name)
+{
+    reg.Add<T>(
+        name,
+        [](T& m, float) {
+            m.Init();
+            m.SetDelay(1200.5f);
+        },
+        [](T& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.Read();
+                m.Write(in[i]);
+            }
+        });
+}
+
+/* FDN reverb with delay memory for sample rates up to 192 kHz */
+template <size_t lines>
+using BufferedFdn = WithBuffer<FdnReverb<lines>, lines * 18400>;
+
+template <size_t lines>
+void AddFdnReverb(BenchRegistry& reg, const char* name)
+{
+    using T = BufferedFdn<lines>;
+    reg.Add<T>(
+        name,
+        [](T& m, float sr) {
+            m.module.Init(sr, m.buffer, lines * 18400);
+            m.module.SetFeedback(0.85f);
+            m.module.SetLpFreq(10000.f);
+        },
+        [](T& m, BenchContext&, const float* in, float* out, size_t n) {
+            /* right channel overwrites the left one, only one is kept */
+            m.module.ProcessBlock(in, in, out, out, n);
+        });
+}
+
+/* Unison: kUnison detuned oscillators mixed down to one output */
+static constexpr size_t kUnison = 64;
+
+struct OscillatorVoices
+{
+    Oscillator voice[kUnison];
+    float      buffer[kFrameChunk];
+};
+
+template <size_t voices>
+void AddOscillatorArray(BenchRegistry& reg, const char* name, uint8_t waveform)
+{
+    reg.Add<OscillatorArray<voices>>(
+        name,
+        [waveform](OscillatorArray<voices>& m, float sr) {
+            m.Init(sr);
+            m.SetWaveform(waveform);
+            for(size_t v = 0; v < voices; v++)
+            {
+                m.SetFreq(v, 110.f * (1.f + 0.001f * v));
+                m.Reset(v, v / static_cast<float>(voices));
+            }
+        },
+        [](OscillatorArray<voices>& m, BenchContext&, const float*, float* out, size_t n) {
+            m.RenderMix(out, n);
+        });
+}
+
+void AddOscillatorVoices(BenchRegistry& reg, const char* name, uint8_t waveform)
+{
+    reg.Add<OscillatorVoices>(
+        name,
+        [waveform](OscillatorVoices& m, float sr) {
+            for(size_t v = 0; v < kUnison; v++)
+            {
+                m.voice[v].Init(sr);
+                m.voice[v].SetWaveform(waveform);
+                m.voice[v].SetFreq(110.f * (1.f + 0.001f * v));
+            }
+        },
+        [](OscillatorVoices& m, BenchContext&, const float*, float* out, size_t n) {
+            for(size_t start = 0; start < n; start += kFrameChunk)
+            {
+                const size_t frames = DSY_MIN(kFrameChunk, n - start);
+                for(size_t i = 0; i < frames; i++)
+                {
+                    out[start + i] = 0.f;
+                }
+                for(size_t v = 0; v < kUnison; v++)
+                {
+                    m.voice[v].Render(m.buffer, frames);
+                    for(size_t i = 0; i < frames; i++)
+                    {
+                        out[start + i] += m.buffer[i];
+                    }
+                }
+            }
+        });
+}
+
+/* Polyphony spread over threads: kScheduledVoices StringVoices summed by
+   a VoiceScheduler. One benchmark sample is one frame of all voices. */
+static constexpr size_t kScheduledVoices = 16;
+
+struct ScheduledVoices
+{
+    StringVoice                        voice[kScheduledVoices];
+    VoiceScheduler<kScheduledVoices, 4> scheduler;
+};
+
+void AddScheduledVoices(BenchRegistry& reg, const char* name, size_t threads)
+{
+    reg.Add<ScheduledVoices>(
+        name,
+        [threads](ScheduledVoices& m, float sr) {
+            for(size_t v = 0; v < kScheduledVoices; v++)
+            {
+                m.voice[v].Init(sr);
+                m.voice[v].SetFreq(110.f * (1.f + 0.1f * v));
+                m.scheduler.AddVoice(m.voice[v]);
+            }
+            /* never more threads than cores, the workers spin */
+            const size_t cores = std::thread::hardware_concurrency();
+            m.scheduler.Init(DSY_MAX(DSY_MIN(threads, cores), size_t(1)));
+        },
+        [](ScheduledVoices& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            bool trigger = false;
+            for(size_t i = 0; i < n; i++)
+            {
+                trigger = ctx.Trigger() || trigger;
+            }
+            for(size_t v = 0; trigger && v < kScheduledVoices; v++)
+            {
+                m.voice[v].Trig();
+            }
+            m.scheduler.Process(out, n);
+        });
+}
+
+/* Drum polyphony: kDrumVoices voices of one type summed, struck in turn on
+   every trigger. One benchmark sample is one frame of all voices. */
+static constexpr size_t kDrumVoices = 16;
+
+template <typename Voice>
+struct DrumVoices
+{
+    Voice  voice[kDrumVoices];
+    size_t next;
+};
+
+template <typename Voice>
+struct DrumBankVoices
+{
+    DrumBank<Voice, kDrumVoices> bank;
+    size_t                       next;
+};
+
+template <typename Voice>
+void AddDrumVoices(BenchRegistry& reg, const char* name, float freq)
+{
+    reg.Add<DrumVoices<Voice>>(
+        name,
+        [freq](DrumVoices<Voice>& m, float sr) {
+            for(size_t v = 0; v < kDrumVoices; v++)
+            {
+                m.voice[v].Init(sr);
+                m.voice[v].SetFreq(freq * (1.f + 0.05f * v));
+            }
+            m.next = 0;
+        },
+        [](DrumVoices<Voice>& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                const size_t struck
+                    = ctx.Trigger() ? m.next++ % kDrumVoices : kDrumVoices;
+                float sum = 0.f;
+                for(size_t v = 0; v < kDrumVoices; v++)
+                {
+                    sum += m.voice[v].Process(v == struck);
+                }
+                out[i] = sum;
+            }
+        });
+}
+
+template <typename Voice>
+void AddDrumBank(BenchRegistry& reg, const char* name, float freq)
+{
+    reg.Add<DrumBankVoices<Voice>>(
+        name,
+        [freq](DrumBankVoices<Voice>& m, float sr) {
+            m.bank.Init(sr);
+            for(size_t v = 0; v < kDrumVoices; v++)
+            {
+                m.bank.GetVoice(v).SetFreq(freq * (1.f + 0.05f * v));
+            }
+            m.next = 0;
+        },
+        [](DrumBankVoices<Voice>& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                if(ctx.Trigger())
+                    m.bank.Trig(m.next++ % kDrumVoices, i);
+            }
+            m.bank.RenderSum(out, n);
+        });
+}
+
+} // namespace
+
+
+namespace daisysp
+{
+namespace bench
+{
+void RegisterControl(BenchRegistry& reg)
+{
+    AddEnvelope<Ad>(
+        reg,
+        "Ad",
+        [](Ad& m, float sr) {
+            m.Init(sr);
+            m.SetAttackTime(0.01f);
+            m.SetDecayTime(0.2f);
+        },
+        TrigHard());
+    AddEnvelope<Ade>(
+        reg,
+        "Ade",
+        [](Ade& m, float sr) {
+            m.Init(sr);
+            m.SetAttackTime(0.01f);
+            m.SetDecayTime(0.1f);
+        },
+        TrigHard());
+    AddEnvelope<AdEnv>(
+        reg,
+        "AdEnv",
+        [](AdEnv& m, float sr) {
+            m.Init(sr);
+            m.SetTime(ADENV_SEG_ATTACK, 0.01f);
+            m.SetTime(ADENV_SEG_DECAY, 0.2f);
+        },
+        TrigPlain());
+    AddEnvelope<Ahd>(
+        reg,
+        "Ahd",
+        [](Ahd& m, float sr) {
+            m.Init(sr);
+            m.SetAttackTime(0.01f);
+            m.SetHoldTime(0.05f);
+            m.SetDecayTime(0.1f);
+        },
+        TrigHard());
+    AddEnvelope<Dec>(
+        reg,
+        "Dec",
+        [](Dec& m, float sr) {
+            m.Init(sr);
+            m.SetDecayTime(0.2f);
+        },
+        TrigPlain());
+
+    reg.Add<Adsr>(
+        "Adsr",
+        [](Adsr& m, float sr) {
+            m.Init(sr);
+            m.SetAttackTime(0.01f);
+            m.SetDecayTime(0.05f);
+            m.SetSustainLevel(0.5f);
+            m.SetReleaseTime(0.1f);
+        },
+        [](Adsr& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.Process(ctx.Gate());
+            }
+        });
+    reg.Add<Line>(
+        "Line",
+        [](Line& m, float sr) { m.Init(sr); },
+        [](Line& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            uint8_t finished;
+            for(size_t i = 0; i < n; i++)
+            {
+                if(ctx.Trigger())
+                {
+                    m.Start(0.f, 1.f, 0.2f);
+                }
+                out[i] = m.Process(&finished);
+            }
+        });
+    AddGenerator<Phasor>(reg, "Phasor", [](Phasor& m, float sr) {
+        m.Init(sr, 440.f);
+    });
+    reg.Add<FM_utility>(
+        "FM_utility",
+        [](FM_utility&, float) {},
+        [](FM_utility& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.tanh_approx(m.Sigmoid(in[i], 0.5f));
+            }
+        });
+}
+
+void RegisterDrums(BenchRegistry& reg)
+{
+    AddTriggered<AnalogBassDrum>(
+        reg, "AnalogBassDrum", [](AnalogBassDrum& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(50.f);
+        });
+    AddTriggered<AnalogSnareDrum>(
+        reg, "AnalogSnareDrum", [](AnalogSnareDrum& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(200.f);
+        });
+    AddTriggered<HiHat<SquareNoise>>(
+        reg, "HiHat<SquareNoise>", [](HiHat<SquareNoise>& m, float sr) {
+            m.Init(sr);
+        });
+    AddTriggered<HiHat<RingModNoise>>(
+        reg, "HiHat<RingModNoise>", [](HiHat<RingModNoise>& m, float sr) {
+            m.Init(sr);
+        });
+    AddTriggered<SyntheticBassDrum>(
+        reg, "SyntheticBassDrum", [](SyntheticBassDrum& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(50.f);
+        });
+    AddTriggered<SyntheticSnareDrum>(
+        reg, "SyntheticSnareDrum", [](SyntheticSnareDrum& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(200.f);
+        });
+    reg.Add<SquareNoise>(
+        "SquareNoise",
+        [](SquareNoise& m, float sr) { m.Init(sr); },
+        [](SquareNoise& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            const float f0 = 6000.f / ctx.SampleRate();
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.Process(f0);
+            }
+        });
+    reg.Add<RingModNoise>(
+        "RingModNoise",
+        [](RingModNoise& m, float sr) { m.Init(sr); },
+        [](RingModNoise& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            const float f0 = 6000.f / ctx.SampleRate();
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.Process(f0);
+            }
+        });
+}
+
+void RegisterDynamics(BenchRegistry& reg)
+{
+    reg.Add<Balance>(
+        "Balance",
+        [](Balance& m, float sr) { m.Init(sr); },
+        [](Balance& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.Process(in[i], 0.5f);
+            }
+        });
+    AddEffect<Compressor>(reg, "Compressor", [](Compressor& m, float sr) {
+        m.Init(sr);
+        m.SetThreshold(-12.f);
+        m.SetRatio(4.f);
+    });
+    reg.Add<CrossFade>(
+        "CrossFade",
+        [](CrossFade& m, float) {
+            m.Init(CROSSFADE_CPOW);
+            m.SetPos(0.3f);
+        },
+        [](CrossFade& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                float a = in[i], b = -in[i];
+                out[i]  = m.Process(a, b);
+            }
+        });
+    reg.Add<Limiter>(
+        "Limiter",
+        [](Limiter& m, float) { m.Init(); },
+        [](Limiter& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = in[i];
+            }
+            m.ProcessBlock(out, n, 2.f);
+        });
+}
+
+void RegisterEffects(BenchRegistry& reg)
+{
+    AddEffect<Autowah>(reg, "Autowah", [](Autowah& m, float sr) {
+        m.Init(sr);
+        m.SetWah(0.5f);
+    });
+    AddEffect<Bitcrush>(reg, "Bitcrush", [](Bitcrush& m, float sr) {
+        m.Init(sr);
+        m.SetBitDepth(6);
+        m.SetCrushRate(10000.f);
+    });
+    AddEffect<Chorus>(reg, "Chorus", [](Chorus& m, float sr) { m.Init(sr); });
+    AddEffect<Decimator>(reg, "Decimator", [](Decimator& m, float) {
+        m.Init();
+    });
+    AddEffect<Flanger>(reg, "Flanger", [](Flanger& m, float sr) {
+        m.Init(sr);
+    });
+    AddEffect<Fold>(reg, "Fold", [](Fold& m, float) {
+        m.Init();
+        m.SetIncrement(2.f);
+    });
+    AddEffect<Overdrive>(reg, "Overdrive", [](Overdrive& m, float) {
+        m.Init();
+        m.SetDrive(0.6f);
+    });
+    AddEffect<Phaser>(reg, "Phaser", [](Phaser& m, float sr) { m.Init(sr); });
+    AddEffect<PitchShifter>(reg, "PitchShifter", [](PitchShifter& m, float sr) {
+        m.Init(sr);
+        m.SetTransposition(7.f);
+    });
+    reg.Add<ReverbSc>(
+        "ReverbSc",
+        [](ReverbSc& m, float sr) {
+            m.Init(sr);
+            m.SetFeedback(0.85f);
+            m.SetLpFreq(10000.f);
+        },
+        [](ReverbSc& m, BenchContext&, const float* in, float* out, size_t n) {
+            float r;
+            for(size_t i = 0; i < n; i++)
+            {
+                m.Process(in[i], in[i], &out[i], &r);
+            }
+        });
+    AddEffect<SampleRateReducer>(
+        reg, "SampleRateReducer", [](SampleRateReducer& m, float) {
+            m.Init();
+            m.SetFreq(0.2f);
+        });
+    AddEffect<Tremolo>(reg, "Tremolo", [](Tremolo& m, float sr) {
+        m.Init(sr);
+        m.SetFreq(5.f);
+        m.SetDepth(0.5f);
+    });
+}
+
+void RegisterFilters(BenchRegistry& reg)
+{
+    reg.Add<BufferedAllpass>(
+        "Allpass",
+        [](BufferedAllpass& m, float sr) {
+            m.module.Init(sr, m.buffer, kCombSize);
+            m.module.SetFreq(0.05f);
+        },
+        [](BufferedAllpass& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.module.Process(in[i]);
+            }
+        });
+    AddEffect<ATone>(reg, "ATone", [](ATone& m, float sr) {
+        m.Init(sr);
+        float freq = 200.f;
+        m.SetFreq(freq);
+    });
+    AddEffect<Biquad>(reg, "Biquad", [](Biquad& m, float sr) {
+        m.Init(sr);
+        m.SetCutoff(1000.f);
+        m.SetRes(0.5f);
+    });
+    AddEffect<BelaBiquad>(reg, "BelaBiquad", [](BelaBiquad& m, float sr) {
+        m.Init(sr);
+    });
+    reg.Add<BufferedComb>(
+        "Comb",
+        [](BufferedComb& m, float sr) {
+            m.module.Init(sr, m.buffer, kCombSize);
+            m.module.SetFreq(100.f);
+        },
+        [](BufferedComb& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.module.Process(in[i]);
+            }
+        });
+    AddEffect<Mode>(reg, "Mode", [](Mode& m, float sr) {
+        m.Init(sr);
+        m.SetFreq(500.f);
+        m.SetQ(50.f);
+    });
+    AddEffect<MoogLadder>(reg, "MoogLadder", [](MoogLadder& m, float sr) {
+        m.Init(sr);
+        m.SetFreq(1000.f);
+        m.SetRes(0.7f);
+    });
+    reg.Add<NlFilt>(
+        "NlFilt",
+        [](NlFilt& m, float) {
+            m.Init();
+            m.SetCoefficients(0.4f, 0.2f, 0.1f, 0.05f, 20.f);
+        },
+        [](NlFilt& m, BenchContext&, const float* in, float* out, size_t n) {
+            m.ProcessBlock(const_cast<float*>(in), out, n);
+        });
+    reg.Add<Svf>(
+        "Svf",
+        [](Svf& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(1000.f);
+            m.SetRes(0.5f);
+        },
+        [](Svf& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                m.Process(in[i]);
+                out[i] = m.Low();
+            }
+        });
+    reg.Add<Svf>(
+        "Svf (audio rate fm)",
+        [](Svf& m, float sr) {
+            m.Init(sr);
+            m.SetRes(0.5f);
+        },
+        [](Svf& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                m.SetFreq(mtof(60.f + 24.f * in[i]));
+                m.Process(in[i]);
+                out[i] = m.Low();
+            }
+        });
+    reg.Add<SvfVoices>(
+        "Svf x32",
+        [](SvfVoices& m, float sr) {
+            for(size_t v = 0; v < kVoices; v++)
+            {
+                m.voice[v].Init(sr);
+                m.voice[v].SetFreq(200.f + 50.f * v);
+                m.voice[v].SetRes(0.5f);
+            }
+        },
+        [](SvfVoices& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                float sum = 0.f;
+                for(size_t v = 0; v < kVoices; v++)
+                {
+                    m.voice[v].Process(in[i]);
+                    sum += m.voice[v].Low();
+                }
+                out[i] = sum;
+            }
+        });
+    reg.Add<SvfBankFrames>(
+        "SvfBank<32>",
+        [](SvfBankFrames& m, float sr) {
+            m.bank.Init(sr);
+            for(size_t v = 0; v < kVoices; v++)
+            {
+                m.bank.SetFreq(v, 200.f + 50.f * v);
+                m.bank.SetRes(v, 0.5f);
+            }
+        },
+        [](SvfBankFrames& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t start = 0; start < n; start += kFrameChunk)
+            {
+                const size_t frames = DSY_MIN(kFrameChunk, n - start);
+                for(size_t i = 0; i < frames; i++)
+                {
+                    for(size_t v = 0; v < kVoices; v++)
+                    {
+                        m.in[i * kVoices + v] = in[start + i];
+                    }
+                }
+                m.bank.ProcessBlock(
+                    m.in, m.low, nullptr, nullptr, nullptr, nullptr, frames);
+                for(size_t i = 0; i < frames; i++)
+                {
+                    float sum = 0.f;
+                    for(size_t v = 0; v < kVoices; v++)
+                    {
+                        sum += m.low[i * kVoices + v];
+                    }
+                    out[start + i] = sum;
+                }
+            }
+        });
+    reg.Add<Svf_legacy>(
+        "Svf_legacy",
+        [](Svf_legacy& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(1000.f);
+            m.SetRes(0.5f);
+        },
+        [](Svf_legacy& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                m.Process(in[i]);
+                out[i] = m.Low();
+            }
+        });
+    AddEffect<Tone>(reg, "Tone", [](Tone& m, float sr) {
+        m.Init(sr);
+        float freq = 1000.f;
+        m.SetFreq(freq);
+    });
+    AddFir<FIRFilterImplGeneric<kFirTaps, kFirBlock>, kFirTaps>(
+        reg, "FIRGeneric<64>");
+    AddFir<FIRFilterImplCircular<kFirTaps, kFirBlock>, kFirTaps>(
+        reg, "FIRCircular<64>");
+    AddFir<FIRFilterImplGeneric<256, kFirBlock>, 256>(reg, "FIRGeneric<256>");
+    AddFir<FIRFilterImplCircular<256, kFirBlock>, 256>(reg,
+                                                        "FIRCircular<256>");
+    AddFir<FIRFilterImplGeneric<kLongTaps, kFirBlock>, kLongTaps>(
+        reg, "FIRGeneric<4096>");
+    AddFir<FIRFilterImplCircular<kLongTaps, kFirBlock>, kLongTaps>(
+        reg, "FIRCircular<4096>");
+    reg.Add<FastConvLong>(
+        "FastConv<4096>",
+        [](FastConvLong& m, float) {
+            static float ir[kLongTaps];
+            MakeIR(ir, kLongTaps);
+            m.SetIR(ir, kLongTaps, true);
+        },
+        [](FastConvLong& m,
+           BenchContext&,
+           const float* in,
+           float*       out,
+           size_t n) { m.ProcessBlock(in, out, n); });
+}
+
+void RegisterNoise(BenchRegistry& reg)
+{
+    AddGenerator<ClockedNoise>(reg, "ClockedNoise", [](ClockedNoise& m, float sr) {
+        m.Init(sr);
+        m.SetFreq(1000.f);
+    });
+    AddGenerator<Dust>(reg, "Dust", [](Dust& m, float) { m.Init(); });
+    AddGenerator<FractalRandomGenerator<ClockedNoise, 5>>(
+        reg,
+        "FractalRandomGenerator<5>",
+        [](FractalRandomGenerator<ClockedNoise, 5>& m, float sr) {
+            m.Init(sr);
+        });
+    AddGenerator<GrainletOscillator>(
+        reg, "GrainletOscillator", [](GrainletOscillator& m, float sr) {
+            m.Init(sr);
+        });
+    AddGenerator<Particle>(reg, "Particle", [](Particle& m, float sr) {
+        m.Init(sr);
+    });
+    AddGenerator<WhiteNoise>(reg, "WhiteNoise", [](WhiteNoise& m, float) {
+        m.Init();
+    });
+    AddGenerator<SIDNoise>(reg, "SIDNoise", [](SIDNoise& m, float sr) {
+        m.Init(sr);
+    });
+}
+
+void RegisterPhysicalModeling(BenchRegistry& reg)
+{
+    AddTriggered<Drip>(reg, "Drip", [](Drip& m, float sr) {
+        m.Init(sr, 0.1f);
+    });
+    AddTriggered<ModalVoice>(reg, "ModalVoice", [](ModalVoice& m, float sr) {
+        m.Init(sr);
+        m.SetFreq(220.f);
+    });
+    reg.Add<BufferedPluck>(
+        "Pluck",
+        [](BufferedPluck& m, float sr) {
+            m.module.Init(sr, m.buffer, kPluckSize, PLUCK_MODE_RECURSIVE);
+            m.module.SetFreq(220.f);
+        },
+        [](BufferedPluck& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                float trig = ctx.Trigger() ? 1.f : 0.f;
+                out[i]     = m.module.Process(trig);
+            }
+        });
+    reg.Add<BufferedMSM>(
+        "MSM_Pluck",
+        [](BufferedMSM& m, float sr) {
+            m.module.Init(
+                sr, m.buffer, kPluckSize, MSM_Pluck::PLUCK_MODE_RECURSIVE);
+            m.module.SetFreq(220.f);
+        },
+        [](BufferedMSM& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                float trig = ctx.Trigger() ? 1.f : 0.f;
+                out[i]     = m.module.Process(trig);
+            }
+        });
+    reg.Add<PolyPluck<8>>(
+        "PolyPluck<8>",
+        [](PolyPluck<8>& m, float sr) { m.Init(sr); },
+        [](PolyPluck<8>& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                float trig = ctx.Trigger() ? 1.f : 0.f;
+                out[i]     = m.Process(trig, 57.f);
+            }
+        });
+    reg.Add<Resonator>(
+        "Resonator",
+        [](Resonator& m, float sr) {
+            m.Init(0.015f, 24, sr);
+            m.SetFreq(220.f);
+        },
+        [](Resonator& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.Process(in[i]);
+            }
+        });
+    reg.Add<String>(
+        "String",
+        [](String& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(110.f);
+        },
+        [](String& m, BenchContext& ctx, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.Process(ctx.Trigger() ? in[i] : 0.f);
+            }
+        });
+    AddTriggered<StringVoice>(reg, "StringVoice", [](StringVoice& m, float sr) {
+        m.Init(sr);
+        m.SetFreq(110.f);
+    });
+    AddScheduledVoices(reg, "StringVoice x16 (1 thread)", 1);
+    AddScheduledVoices(reg, "StringVoice x16 (4 threads)", 4);
+    AddDrumVoices<AnalogSnareDrum>(reg, "AnalogSnareDrum x16", 200.f);
+    AddDrumBank<AnalogSnareDrum>(reg, "DrumBank<AnalogSnareDrum, 16>", 200.f);
+    AddDrumVoices<AnalogBassDrum>(reg, "AnalogBassDrum x16", 50.f);
+    AddDrumBank<AnalogBassDrum>(reg, "DrumBank<AnalogBassDrum, 16>", 50.f);
+    AddDrumVoices<HiHat<>>(reg, "HiHat x16", 3000.f);
+    AddDrumBank<HiHat<>>(reg, "DrumBank<HiHat<>, 16>", 3000.f);
+}
+
+void RegisterSynthesis(BenchRegistry& reg)
+{
+    AddGenerator<BlOsc>(reg, "BlOsc", [](BlOsc& m, float sr) {
+        m.Init(sr);
+        m.SetFreq(440.f);
+    });
+    AddGenerator<Fm2>(reg, "Fm2", [](Fm2& m, float sr) {
+        m.Init(sr);
+        m.SetFrequency(440.f);
+    });
+    AddGenerator<FormantOscillator>(
+        reg, "FormantOscillator", [](FormantOscillator& m, float sr) {
+            m.Init(sr);
+        });
+    AddGenerator<HarmonicOscillator<16>>(
+        reg, "HarmonicOscillator<16>", [](HarmonicOscillator<16>& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(110.f);
+        });
+    AddGenerator<Oscillator>(reg, "Oscillator(sin)", [](Oscillator& m, float sr) {
+        m.Init(sr);
+        m.SetWaveform(Oscillator::WAVE_SIN);
+    });
+    AddGenerator<Oscillator>(
+        reg, "Oscillator(polyblep saw)", [](Oscillator& m, float sr) {
+            m.Init(sr);
+            m.SetWaveform(Oscillator::WAVE_POLYBLEP_SAW);
+        });
+    AddOscillatorVoices(reg, "Oscillator x64 (sin, block)", Oscillator::WAVE_SIN);
+    AddOscillatorArray<64>(
+        reg, "OscillatorArray<64> (sin)", Oscillator::WAVE_SIN);
+    AddOscillatorVoices(reg,
+                        "Oscillator x64 (polyblep saw, block)",
+                        Oscillator::WAVE_POLYBLEP_SAW);
+    AddOscillatorArray<8>(
+        reg, "OscillatorArray<8> (polyblep saw)", Oscillator::WAVE_POLYBLEP_SAW);
+    AddOscillatorArray<16>(reg,
+                           "OscillatorArray<16> (polyblep saw)",
+                           Oscillator::WAVE_POLYBLEP_SAW);
+    AddOscillatorArray<64>(reg,
+                           "OscillatorArray<64> (polyblep saw)",
+                           Oscillator::WAVE_POLYBLEP_SAW);
+    AddGenerator<OscillatorBank>(
+        reg, "OscillatorBank", [](OscillatorBank& m, float sr) {
+            m.Init(sr);
+        });
+    AddGenerator<VariableSawOscillator>(
+        reg, "VariableSawOscillator", [](VariableSawOscillator& m, float sr) {
+            m.Init(sr);
+        });
+    AddGenerator<VariableShapeOscillator>(
+        reg,
+        "VariableShapeOscillator",
+        [](VariableShapeOscillator& m, float sr) { m.Init(sr); });
+    AddGenerator<VosimOscillator>(
+        reg, "VosimOscillator", [](VosimOscillator& m, float sr) {
+            m.Init(sr);
+        });
+    AddGenerator<ZOscillator>(reg, "ZOscillator", [](ZOscillator& m, float sr) {
+        m.Init(sr);
+    });
+    reg.Add<SineOscillator>(
+        "SineOscillator",
+        [](SineOscillator& m, float sr) { m.Init(sr); },
+        [](SineOscillator& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            m.Render(440.f / ctx.SampleRate(), out, n);
+        });
+    reg.Add<FastSineOscillator>(
+        "FastSineOscillator",
+        [](FastSineOscillator& m, float) { m.Init(); },
+        [](FastSineOscillator& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            m.Render(440.f / ctx.SampleRate(), out, n);
+        });
+}
+
+void RegisterUtility(BenchRegistry& reg)
+{
+    AddEffect<DcBlock>(reg, "DcBlock", [](DcBlock& m, float sr) { m.Init(sr); });
+    reg.Add<DelayLine<float, 48000>>(
+        "DelayLine<48000>",
+        [](DelayLine<float, 48000>& m, float) {
+            m.Init();
+            m.SetDelay(12000.5f);
+        },
+        [](DelayLine<float, 48000>& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.Read();
+                m.Write(in[i]);
+            }
+        });
+    AddDelayLine<DelayLine<float, kChorusDelay>>(reg, "DelayLine<2400>");
+    AddDelayLine<ChorusDelayPow2>(reg, "DelayLine<2400, pow2>");
+    reg.Add<ChorusDelayPow2>(
+        "DelayLine<2400, pow2> (block)",
+        [](ChorusDelayPow2& m, float) {
+            m.Init();
+            m.SetDelay(1200.5f);
+        },
+        [](ChorusDelayPow2& m, BenchContext&, const float* in, float* out, size_t n) {
+            m.ReadBlock(out, n);
+            m.WriteBlock(in, n);
+        });
+    reg.Add<ChorusDelayPow2>(
+        "DelayLine<2400, pow2> (8 taps)",
+        [](ChorusDelayPow2& m, float) { m.Init(); },
+        [](ChorusDelayPow2& m, BenchContext&, const float* in, float* out, size_t n) {
+            static const float delays[8]
+                = {101.5f, 233.2f, 407.7f, 613.1f, 811.9f, 1013.3f, 1531.4f, 2011.6f};
+            float taps[8];
+            for(size_t i = 0; i < n; i++)
+            {
+                m.ReadMany(delays, taps, 8);
+                out[i] = taps[0] + taps[1] + taps[2] + taps[3] + taps[4]
+                         + taps[5] + taps[6] + taps[7];
+                m.Write(in[i]);
+            }
+        });
+    AddGenerator<Jitter>(reg, "Jitter", [](Jitter& m, float sr) { m.Init(sr); });
+    reg.Add<BufferedLooper>(
+        "Looper",
+        [](BufferedLooper& m, float) {
+            m.module.Init(m.buffer, kLooperSize);
+            m.module.TrigRecord();
+        },
+        [](BufferedLooper& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.module.Process(in[i]);
+            }
+        });
+    reg.Add<Maytrig>(
+        "Maytrig",
+        [](Maytrig&, float) {},
+        [](Maytrig& m, BenchContext&, const float*, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.Process(0.5f);
+            }
+        });
+    reg.Add<Metro>(
+        "Metro",
+        [](Metro& m, float sr) { m.Init(2.f, sr); },
+        [](Metro& m, BenchContext&, const float*, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.Process();
+            }
+        });
+    AddEffect<Port>(reg, "Port", [](Port& m, float sr) { m.Init(sr, 0.01f); });
+    reg.Add<PatternPredictor<>>(
+        "PatternPredictor",
+        [](PatternPredictor<>& m, float) { m.Init(); },
+        [](PatternPredictor<>& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                const uint32_t v = static_cast<uint32_t>(in[i] * 1000.f + 1000.f);
+                out[i] = static_cast<float>(m.Predict(v));
+            }
+        });
+    reg.Add<float>(
+        "ParameterInterpolator",
+        [](float& state, float) { state = 0.f; },
+        [](float& state, BenchContext&, const float* in, float* out, size_t n) {
+            ParameterInterpolator interp(&state, in[0], n);
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = interp.Next();
+            }
+        });
+    reg.Add<ParameterSet<4>>(
+        "ParameterSet (change every block)",
+        [](ParameterSet<4>& m, float) { m.Init(); },
+        [](ParameterSet<4>& m, BenchContext&, const float* in, float* out, size_t n) {
+            /* pushed from the audio thread here, the cost is the same */
+            m.Set(0, in[0]);
+            m.Set(1, in[0], m.GetTime() + static_cast<uint32_t>(n / 2));
+            for(size_t done = 0; done < n;)
+            {
+                const size_t          todo = m.Update(n - done);
+                ParameterInterpolator interp(m.GetState(0), m.Get(0), todo);
+                const float           offset = m.Get(1);
+                for(size_t i = 0; i < todo; i++)
+                {
+                    out[done + i] = interp.Next() + offset;
+                }
+                done += todo;
+            }
+        });
+    reg.Add<SampleHold>(
+        "SampleHold",
+        [](SampleHold&, float) {},
+        [](SampleHold& m, BenchContext& ctx, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = m.Process(ctx.Trigger(), in[i]);
+            }
+        });
+    AddGenerator<SmoothRandomGenerator>(
+        reg, "SmoothRandomGenerator", [](SmoothRandomGenerator& m, float sr) {
+            m.Init(sr);
+        });
+    AddResampler<8>(reg, "Resampler<8> 44.1k->48k", 48000.f / 44100.f);
+    AddResampler<16>(reg, "Resampler<16> 44.1k->48k", 48000.f / 44100.f);
+    AddResampler<32>(reg, "Resampler<32> 44.1k->48k", 48000.f / 44100.f);
+    AddResampler<16>(reg, "Resampler<16> 48k->44.1k", 44100.f / 48000.f);
+    reg.Add<Varispeed>(
+        "Resampler<16> varispeed",
+        [](Varispeed& m, float) {
+            m.resampler.Init(1.f);
+            m.phase = 0.f;
+        },
+        [](Varispeed& m, BenchContext&, const float* in, float* out, size_t n) {
+            m.phase += 0.01f;
+            m.resampler.SetRatio(1.f / (1.f + 0.5f * sinf(m.phase)));
+            m.resampler.Process(in, n, out, n, nullptr);
+        });
+}
+
+/* Per-sample call of a scalar function */
+template <float (*fn)(float)>
+void AddScalar(BenchRegistry& reg, const char* name)
+{
+    reg.Add<float>(
+        name,
+        [](float& state, float) { state = 0.f; },
+        [](float&, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                out[i] = fn(in[i]);
+            }
+        });
+}
+
+/* Array kernel from dsp.h */
+template <void (*kernel)(const float*, float*, size_t)>
+void AddKernel(BenchRegistry& reg, const char* name)
+{
+    reg.Add<float>(
+        name,
+        [](float& state, float) { state = 0.f; },
+        [](float&, BenchContext&, const float* in, float* out, size_t n) {
+            kernel(in, out, n);
+        });
+}
+
+float Mtof440(float m)
+{
+    return powf(2.f, (m - 69.f) / 12.f) * 440.f;
+}
+
+float DbToGainPow(float db)
+{
+    return powf(10.f, db * 0.05f);
+}
+
+/* Array kernels against per-sample libm, on the same noise input */
+void RegisterFastMath(BenchRegistry& reg)
+{
+    AddScalar<exp2f>(reg, "exp2f (libm)");
+    AddKernel<simd::Exp2>(reg, "simd::Exp2 (block)");
+    AddScalar<tanhf>(reg, "tanhf (libm)");
+    AddKernel<simd::Tanh>(reg, "simd::Tanh (block)");
+    AddScalar<sinf>(reg, "sinf (libm)");
+    AddKernel<simd::Sin>(reg, "simd::Sin (block)");
+    AddScalar<tanf>(reg, "tanf (libm)");
+    AddKernel<simd::Tan>(reg, "simd::Tan (block)");
+    AddScalar<SoftClip>(reg, "SoftClip");
+    AddKernel<simd::SoftClip>(reg, "simd::SoftClip (block)");
+    AddScalar<Mtof440>(reg, "mtof (powf)");
+    AddKernel<simd::Mtof>(reg, "simd::Mtof (block)");
+    AddScalar<DbToGainPow>(reg, "dB to gain (powf)");
+    AddKernel<simd::DbToGain>(reg, "simd::DbToGain (block)");
+}
+
+/* Block API counterparts of a representative set of the cases above */
+void RegisterBlock(BenchRegistry& reg)
+{
+    AddBlockEffect<Biquad>(reg, "Biquad (block)", [](Biquad& m, float sr) {
+        m.Init(sr);
+        m.SetCutoff(1000.f);
+        m.SetRes(0.5f);
+    });
+    AddBlockEffect<Chorus>(
+        reg, "Chorus (block)", [](Chorus& m, float sr) { m.Init(sr); });
+    AddBlockEffect<MoogLadder>(
+        reg, "MoogLadder (block)", [](MoogLadder& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(1000.f);
+            m.SetRes(0.7f);
+        });
+    AddBlockEffect<MoogLadderX4>(
+        reg, "MoogLadder x4 (block)", [](MoogLadderX4& m, float sr) {
+            m.Init();
+            m.GetModule().Init(sr * m.GetFactor());
+            m.GetModule().SetFreq(1000.f);
+            m.GetModule().SetRes(0.7f);
+        });
+    AddBlockEffect<OverdriveX4>(
+        reg, "Overdrive x4 (block)", [](OverdriveX4& m, float) {
+            m.Init();
+            m.GetModule().Init();
+            m.GetModule().SetDrive(0.6f);
+        });
+    AddBlockEffect<Phaser>(
+        reg, "Phaser (block)", [](Phaser& m, float sr) { m.Init(sr); });
+    reg.Add<ReverbSc>(
+        "ReverbSc (block)",
+        [](ReverbSc& m, float sr) {
+            m.Init(sr);
+            m.SetFeedback(0.85f);
+            m.SetLpFreq(10000.f);
+        },
+        [](ReverbSc& m, BenchContext&, const float* in, float* out, size_t n) {
+            /* right channel overwrites the left one, only one is kept */
+            m.ProcessBlock(in, in, out, out, n);
+        });
+    AddFdnReverb<4>(reg, "FdnReverb<4> (block)");
+    AddFdnReverb<8>(reg, "FdnReverb<8> (block)");
+    AddFdnReverb<16>(reg, "FdnReverb<16> (block)");
+    AddFdnReverb<32>(reg, "FdnReverb<32> (block)");
+    AddBlockEffect<Svf>(reg, "Svf (block)", [](Svf& m, float sr) {
+        m.Init(sr);
+        m.SetFreq(1000.f);
+        m.SetRes(0.5f);
+    });
+    /* cutoff moving every block, smoothed per sample the usual way and
+       with the block ramps */
+    reg.Add<Svf>(
+        "Svf (SetFreq every sample)",
+        [](Svf& m, float sr) {
+            m.Init(sr);
+            m.SetRes(0.5f);
+        },
+        [](Svf& m, BenchContext&, const float* in, float* out, size_t n) {
+            for(size_t i = 0; i < n; i++)
+            {
+                m.SetFreq(1000.f + 500.f * in[i]);
+                m.Process(in[i]);
+                out[i] = m.Low();
+            }
+        });
+    reg.Add<Svf>(
+        "Svf (block, freq ramp)",
+        [](Svf& m, float sr) {
+            m.Init(sr);
+            m.SetRes(0.5f);
+        },
+        [](Svf& m, BenchContext&, const float* in, float* out, size_t n) {
+            m.ProcessBlock(in, out, n, 1000.f + 500.f * in[0]);
+        });
+    reg.Add<MoogLadder>(
+        "MoogLadder (block, freq ramp)",
+        [](MoogLadder& m, float sr) {
+            m.Init(sr);
+            m.SetRes(0.7f);
+        },
+        [](MoogLadder& m, BenchContext&, const float* in, float* out, size_t n) {
+            m.ProcessBlock(in, out, n, 1000.f + 500.f * in[0]);
+        });
+    reg.Add<Tone>(
+        "Tone (block, freq ramp)",
+        [](Tone& m, float sr) { m.Init(sr); },
+        [](Tone& m, BenchContext&, const float* in, float* out, size_t n) {
+            m.ProcessBlock(in, out, n, 1000.f + 500.f * in[0]);
+        });
+    reg.Add<Oscillator>(
+        "Oscillator(sin) (block, freq ramp)",
+        [](Oscillator& m, float sr) { m.Init(sr); },
+        [](Oscillator& m, BenchContext&, const float* in, float* out, size_t n) {
+            m.Render(out, n, 440.f + 20.f * in[0], 0.5f);
+        });
+    AddBlockEffect<Tone>(reg, "Tone (block)", [](Tone& m, float sr) {
+        m.Init(sr);
+        float freq = 1000.f;
+        m.SetFreq(freq);
+    });
+    AddBlockGenerator<Oscillator>(
+        reg, "Oscillator(sin) (block)", [](Oscillator& m, float sr) {
+            m.Init(sr);
+        });
+    AddBlockGenerator<Oscillator>(
+        reg, "Oscillator(polyblep saw) (block)", [](Oscillator& m, float sr) {
+            m.Init(sr);
+            m.SetWaveform(Oscillator::WAVE_POLYBLEP_SAW);
+        });
+    AddBlockGenerator<ClockedNoise>(
+        reg, "ClockedNoise (block)", [](ClockedNoise& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(1000.f);
+        });
+    AddBlockGenerator<Dust>(
+        reg, "Dust (block)", [](Dust& m, float) { m.Init(); });
+    AddBlockGenerator<FractalRandomGenerator<ClockedNoise, 5>>(
+        reg,
+        "FractalRandomGenerator<5> (block)",
+        [](FractalRandomGenerator<ClockedNoise, 5>& m, float sr) {
+            m.Init(sr);
+        });
+    AddBlockGenerator<Particle>(
+        reg, "Particle (block)", [](Particle& m, float sr) { m.Init(sr); });
+    AddBlockGenerator<SIDNoise>(
+        reg, "SIDNoise (block)", [](SIDNoise& m, float sr) { m.Init(sr); });
+    AddBlockGenerator<WhiteNoise>(
+        reg, "WhiteNoise (block)", [](WhiteNoise& m, float) { m.Init(); });
+    AddBlockEffect<Resonator>(
+        reg, "Resonator (block)", [](Resonator& m, float sr) {
+            m.Init(0.015f, 24, sr);
+            m.SetFreq(220.f);
+        });
+    AddBlockTriggered<ModalVoice>(
+        reg, "ModalVoice (block)", [](ModalVoice& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(220.f);
+        });
+    AddBlockTriggered<AnalogBassDrum>(
+        reg, "AnalogBassDrum (block)", [](AnalogBassDrum& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(50.f);
+        });
+    AddBlockTriggered<AnalogSnareDrum>(
+        reg, "AnalogSnareDrum (block)", [](AnalogSnareDrum& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(200.f);
+        });
+    AddBlockTriggered<HiHat<SquareNoise>>(
+        reg, "HiHat<SquareNoise> (block)", [](HiHat<SquareNoise>& m, float sr) {
+            m.Init(sr);
+        });
+    AddBlockTriggered<HiHat<RingModNoise>>(
+        reg,
+        "HiHat<RingModNoise> (block)",
+        [](HiHat<RingModNoise>& m, float sr) { m.Init(sr); });
+    reg.Add<SquareNoise>(
+        "SquareNoise (block)",
+        [](SquareNoise& m, float sr) { m.Init(sr); },
+        [](SquareNoise& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            m.Render(6000.f / ctx.SampleRate(), out, n);
+        });
+    reg.Add<RingModNoise>(
+        "RingModNoise (block)",
+        [](RingModNoise& m, float sr) { m.Init(sr); },
+        [](RingModNoise& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            m.Render(6000.f / ctx.SampleRate(), out, n);
+        });
+    AddBlockTriggered<SyntheticBassDrum>(
+        reg, "SyntheticBassDrum (block)", [](SyntheticBassDrum& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(50.f);
+        });
+    AddBlockTriggered<SyntheticSnareDrum>(
+        reg, "SyntheticSnareDrum (block)", [](SyntheticSnareDrum& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(200.f);
+        });
+    AddEventTriggered<ModalVoice>(
+        reg, "ModalVoice (events)", [](ModalVoice& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(220.f);
+        });
+    AddEventTriggered<SyntheticSnareDrum>(
+        reg, "SyntheticSnareDrum (events)", [](SyntheticSnareDrum& m, float sr) {
+            m.Init(sr);
+            m.SetFreq(200.f);
+        });
+    reg.Add<Adsr>(
+        "Adsr (block)",
+        [](Adsr& m, float sr) {
+            m.Init(sr);
+            m.SetAttackTime(0.01f);
+            m.SetDecayTime(0.05f);
+            m.SetSustainLevel(0.5f);
+            m.SetReleaseTime(0.1f);
+        },
+        [](Adsr& m, BenchContext& ctx, const float*, float* out, size_t n) {
+            const bool gate = ctx.Gate();
+            for(size_t i = 1; i < n; i++)
+            {
+                ctx.Gate();
+            }
+            m.Render(gate, out, n);
+        });
+}
+
+void RegisterModules(BenchRegistry& reg)
+{
+    RegisterControl(reg);
+    RegisterDrums(reg);
+    RegisterDynamics(reg);
+    RegisterEffects(reg);
+    RegisterFilters(reg);
+    RegisterNoise(reg);
+    RegisterPhysicalModeling(reg);
+    RegisterSynthesis(reg);
+    RegisterUtility(reg);
+    RegisterFastMath(reg);
+    RegisterBlock(reg);
+}
+
+} // namespace bench
+} // namespace daisysp
@@ -0,0 +1,322 @@
+#pragma once
+#ifndef DSY_BENCH_UTIL_H
+#define DSY_BENCH_UTIL_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**   @brief Host-side benchmark harness for DaisySP modules
+ *
+ *    Every module is wrapped into a BenchModule that knows how to Init()
+ *    itself and how to render one block of audio. The runner feeds the
+ *    modules with a deterministic noise signal, measures the throughput and
+ *    (in a second pass) the worst-case block time, and reports the results
+ *    as a table and (optionally) as JSON.
+ */
+
+namespace daisysp
+{
+namespace bench
+{
+/** Per-run context handed to every Process() call.
+ *  Provides the sample rate and a periodic trigger so that drums, envelopes
+ *  and physical models are re-excited regularly during the measurement.
+ */
+class BenchContext
+{
+  public:
+    BenchContext() : sample_rate_(48000.f), period_(12000), counter_(0) {}
+
+    void Init(float sample_rate)
+    {
+        sample_rate_ = sample_rate;
+        period_      = static_cast<uint32_t>(sample_rate * 0.25f);
+        counter_     = 0;
+    }
+
+    /** Returns true once every 250 ms of audio, advances by one sample */
+    inline bool Trigger()
+    {
+        const bool trig = counter_ == 0;
+        Advance();
+        return trig;
+    }
+
+    /** Returns true for the first half of every 250 ms, advances by one sample */
+    inline bool Gate()
+    {
+        const bool gate = counter_ < period_ / 2;
+        Advance();
+        return gate;
+    }
+
+    inline float SampleRate() const { return sample_rate_; }
+
+  private:
+    inline void Advance()
+    {
+        if(++counter_ >= period_)
+        {
+            counter_ = 0;
+        }
+    }
+
+    float    sample_rate_;
+    uint32_t period_;
+    uint32_t counter_;
+};
+
+/** Type-erased module under test */
+class BenchModule
+{
+  public:
+    virtual ~BenchModule() {}
+
+    /** Initialize the wrapped module for the given sample rate */
+    virtual void Init(float sample_rate) = 0;
+
+    /** Render size samples of out from size samples of in */
+    virtual void Process(const float* in, float* out, size_t size) = 0;
+};
+
+/** Adapter turning a DaisySP module and two callables into a BenchModule
+ *  \param T - module type, default-constructed on the heap
+ *  \param InitFn - void(T&, float sample_rate)
+ *  \param ProcessFn - void(T&, BenchContext&, const float*, float*, size_t)
+ */
+template <typename T, typename InitFn, typename ProcessFn>
+class BenchAdapter : public BenchModule
+{
+  public:
+    BenchAdapter(InitFn init, ProcessFn process)
+    : init_(init), process_(process)
+    {
+    }
+
+    void Init(float sample_rate) override
+    {
+        ctx_.Init(sample_rate);
+        init_(module_, sample_rate);
+    }
+
+    void Process(const float* in, float* out, size_t size) override
+    {
+        process_(module_, ctx_, in, out, size);
+    }
+
+  private:
+    T            module_;
+    BenchContext ctx_;
+    InitFn       init_;
+    ProcessFn    process_;
+};
+
+/** Named factory of a BenchModule */
+struct BenchCase
+{
+    std::string                                  name;
+    std::function<std::unique_ptr<BenchModule>()> create;
+};
+
+/** Collection of all benchmark cases known to the executable */
+class BenchRegistry
+{
+  public:
+    /** Register module T under the given name
+     *  \param name - display name, used for filtering and in the reports
+     *  \param init - void(T&, float sample_rate)
+     *  \param process - void(T&, BenchContext&, const float*, float*, size_t)
+     */
+    template <typename T, typename InitFn, typename ProcessFn>
+    void Add(const char* name, InitFn init, ProcessFn process)
+    {
+        BenchCase c;
+        c.name   = name;
+        c.create = [init, process]() {
+            return std::unique_ptr<BenchModule>(
+                new BenchAdapter<T, InitFn, ProcessFn>(init, process));
+        };
+        cases_.push_back(c);
+    }
+
+    const std::vector<BenchCase>& Cases() const { return cases_; }
+
+  private:
+    std::vector<BenchCase> cases_;
+};
+
+/** Result of one module/sample rate/block size measurement */
+struct BenchResult
+{
+    std::string name;
+    float       sample_rate;
+    size_t      block_size;
+    size_t      samples;
+    double      ns_per_sample;
+    double      samples_per_sec;
+    double      worst_block_ns;
+    double      mean_block_ns;
+    double      realtime_load; /**< fraction of one core at sample_rate */
+};
+
+/** Measurement settings */
+struct BenchConfig
+{
+    std::vector<float>  sample_rates;
+    std::vector<size_t> block_sizes;
+    float               seconds;   /**< amount of audio rendered per run */
+    float               warmup;    /**< audio rendered before timing */
+    std::string         filter;    /**< substring filter on the case name */
+    std::string         json_path; /**< empty for no JSON output */
+};
+
+/** Time a single case at a given sample rate and block size */
+inline BenchResult Measure(const BenchCase&   c,
+                           float              sample_rate,
+                           size_t             block_size,
+                           const BenchConfig& cfg)
+{
+    using clock = std::chrono::steady_clock;
+
+    const size_t total  = static_cast<size_t>(sample_rate * cfg.seconds);
+    const size_t warmup = static_cast<size_t>(sample_rate * cfg.warmup);
+
+    /* Deterministic input signal, one block worth of it, reused */
+    std::vector<float> in(block_size), out(block_size);
+    uint32_t           seed = 1u;
+    for(size_t i = 0; i < block_size; i++)
+    {
+        seed  = seed * 1664525u + 1013904223u;
+        in[i] = static_cast<float>(static_cast<int32_t>(seed))
+                * (0.5f / 2147483648.f);
+    }
+
+    std::unique_ptr<BenchModule> dut = c.create();
+    dut->Init(sample_rate);
+
+    for(size_t done = 0; done < warmup; done += block_size)
+    {
+        dut->Process(in.data(), out.data(), block_size);
+    }
+
+    volatile float sink = 0.f;
+
+    /* Throughput pass, no per-block timer overhead */
+    size_t                  blocks = 0;
+    const clock::time_point t0     = clock::now();
+    for(size_t done = 0; done < total; done += block_size)
+    {
+        dut->Process(in.data(), out.data(), block_size);
+        sink = sink + out[0];
+        blocks++;
+    }
+    const clock::time_point t1 = clock::now();
+
+    /* Worst-case pass, every block timed individually */
+    double worst = 0.0;
+    for(size_t done = 0; done < total; done += block_size)
+    {
+        const clock::time_point b0 = clock::now();
+        dut->Process(in.data(), out.data(), block_size);
+        const clock::time_point b1 = clock::now();
+
+        const double dt
+            = std::chrono::duration<double, std::nano>(b1 - b0).count();
+        worst = dt > worst ? dt : worst;
+        sink  = sink + out[0];
+    }
+    (void)sink;
+
+    const size_t samples = blocks * block_size;
+    const double elapsed
+        = std::chrono::duration<double, std::nano>(t1 - t0).count();
+
+    BenchResult r;
+    r.name            = c.name;
+    r.sample_rate     = sample_rate;
+    r.block_size      = block_size;
+    r.samples         = samples;
+    r.ns_per_sample   = samples > 0 ? elapsed / samples : 0.0;
+    r.samples_per_sec = elapsed > 0.0 ? samples * 1.0e9 / elapsed : 0.0;
+    r.worst_block_ns  = worst;
+    r.mean_block_ns   = blocks > 0 ? elapsed / blocks : 0.0;
+    r.realtime_load   = r.ns_per_sample * sample_rate * 1.0e-9;
+    return r;
+}
+
+/** Print a human readable table row */
+inline void PrintResult(const BenchResult& r)
+{
+    printf("%-36s %7.0f %5zu %10.2f %14.0f %12.0f %8.4f\n",
+           r.name.c_str(),
+           r.sample_rate,
+           r.block_size,
+           r.ns_per_sample,
+           r.samples_per_sec,
+           r.worst_block_ns,
+           r.realtime_load);
+}
+
+inline void PrintHeader()
+{
+    printf("%-36s %7s %5s %10s %14s %12s %8s\n",
+           "module",
+           "sr",
+           "block",
+           "ns/sample",
+           "samples/sec",
+           "worst ns",
+           "load");
+}
+
+/** Write all results as a JSON document for regression tracking */
+inline bool WriteJson(const std::string&              path,
+                      const BenchConfig&              cfg,
+                      const std::vector<BenchResult>& results)
+{
+    FILE* f = fopen(path.c_str(), "w");
+    if(nullptr == f)
+    {
+        return false;
+    }
+
+    fprintf(f, "{\n  \"library\": \"DaisySP\",\n");
+    fprintf(f, "  \"seconds\": %g,\n", cfg.seconds);
+    fprintf(f, "  \"results\": [\n");
+    for(size_t i = 0; i < results.size(); i++)
+    {
+        const BenchResult& r = results[i];
+        fprintf(f,
+                "    {\"module\": \"%s\", \"sample_rate\": %.0f, "
+                "\"block_size\": %zu, \"samples\": %zu, "
+                "\"ns_per_sample\": %.4f, \"samples_per_sec\": %.1f, "
+                "\"worst_block_ns\": %.1f, \"mean_block_ns\": %.1f, "
+                "\"realtime_load\": %.6f}%s\n",
+                r.name.c_str(),
+                r.sample_rate,
+                r.block_size,
+                r.samples,
+                r.ns_per_sample,
+                r.samples_per_sec,
+                r.worst_block_ns,
+                r.mean_block_ns,
+                r.realtime_load,
+                i + 1 < results.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return true;
+}
+
+/** Registration hooks, one per source file of the benchmark executable */
+void RegisterModules(BenchRegistry& reg);
+
+} // namespace bench
+} // namespace daisysp
+
+#endif // DSY_BENCH_UTIL_H
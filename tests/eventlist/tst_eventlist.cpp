@@ -0,0 +1,247 @@
+#include "daisysp.h"
+#include "test_util.h"
+
+/**   @brief EventList unit tests
+ */
+
+using namespace daisysp;
+using namespace daisy;
+
+
+/** Test platform choice, DaisySeed, DaisyPod and DaisyPC are currently supported
+ ** If compiled for a PC target, all platforms would automagically turn into
+ ** DaisyPC */
+using TestPlatform = DsyTestHelper<DaisyPod>;
+static TestPlatform hw;
+
+
+static constexpr float  SAMPLE_RATE = 48000.f;
+static constexpr size_t BLOCK_SIZE  = 64;
+static constexpr size_t NUM_BLOCKS  = 8;
+
+static float DSY_SDRAM_BSS block_out[BLOCK_SIZE * NUM_BLOCKS];
+static float DSY_SDRAM_BSS sample_out[BLOCK_SIZE * NUM_BLOCKS];
+
+/** The offsets of the events, in list order */
+template <size_t capacity>
+static bool HasOffsets(const EventList<capacity>& events,
+                       const uint32_t*            offsets,
+                       size_t                     count)
+{
+    bool pass = events.GetCount() == count;
+    for(size_t i = 0; pass && i < count; i++)
+    {
+        pass &= events[i].offset == offsets[i];
+    }
+    return pass;
+}
+
+/** Events added out of order come out sorted, a full list refuses more */
+static bool add_sorted()
+{
+    static const uint32_t added[]  = {40, 3, 63, 0, 17, 3, 100};
+    static const uint32_t sorted[] = {0, 3, 3, 17, 40, 63, 100};
+
+    EventList<8> events;
+    bool         pass = true;
+    for(size_t i = 0; i < DSY_COUNTOF(added); i++)
+    {
+        pass &= events.Add(added[i]);
+    }
+    pass &= HasOffsets(events, sorted, DSY_COUNTOF(sorted));
+
+    pass &= events.Add(8);
+    pass &= !events.Add(9) && events.GetCount() == 8;
+
+    events.Clear();
+    pass &= events.GetCount() == 0;
+    return pass;
+}
+
+/** Events at the same offset keep the order they were added in */
+static bool same_offset()
+{
+    EventList<8> events;
+    events.Add(10, BlockEvent::GATE_ON, 1.f);
+    events.Add(5, BlockEvent::TRIGGER, 2.f);
+    events.Add(10, BlockEvent::GATE_OFF, 3.f);
+    events.Add(10, BlockEvent::TRIGGER, 4.f);
+    events.Add(2, BlockEvent::USER, 5.f);
+
+    bool pass = events.GetCount() == 5;
+    pass &= events[0].type == BlockEvent::USER && events[0].value == 5.f;
+    pass &= events[1].type == BlockEvent::TRIGGER && events[1].value == 2.f;
+    pass &= events[2].type == BlockEvent::GATE_ON && events[2].value == 1.f;
+    pass &= events[3].type == BlockEvent::GATE_OFF && events[3].value == 3.f;
+    pass &= events[4].type == BlockEvent::TRIGGER && events[4].value == 4.f;
+    return pass;
+}
+
+/** Remove() closes the gap and ignores indices past the end */
+static bool remove_events()
+{
+    static const uint32_t left[] = {1, 3};
+
+    EventList<4> events;
+    events.Remove(0);
+    bool pass = events.GetCount() == 0;
+
+    events.Add(1);
+    events.Add(2);
+    events.Add(3);
+    events.Remove(1);
+    events.Remove(2);
+    events.Remove(100);
+    pass &= HasOffsets(events, left, DSY_COUNTOF(left));
+
+    events.Remove(0);
+    events.Remove(0);
+    events.Remove(0);
+    pass &= events.GetCount() == 0 && events.Add(7);
+    return pass;
+}
+
+/** Advance() drops the events of the block and moves the later ones into
+ ** the next block */
+static bool advance_carry()
+{
+    static const uint32_t next[]  = {0, 10, 36};
+    static const uint32_t after[] = {36 - 32};
+
+    EventList<8> events;
+    events.Add(0);
+    events.Add(63);
+    events.Add(64);
+    events.Add(74);
+    events.Add(100);
+
+    events.Advance(64);
+    bool pass = HasOffsets(events, next, DSY_COUNTOF(next));
+    events.Advance(32);
+    pass &= HasOffsets(events, after, DSY_COUNTOF(after));
+    events.Advance(5);
+    pass &= events.GetCount() == 0;
+    events.Advance(64);
+    pass &= events.GetCount() == 0;
+    return pass;
+}
+
+/** Events scheduled across several blocks trigger a drum at the same
+ ** samples as a Process() loop */
+static bool render_triggered()
+{
+    static const size_t triggers[] = {0, 5, 5, 70, 200, 511};
+
+    AnalogBassDrum sample_kick, block_kick;
+    sample_kick.Init(SAMPLE_RATE);
+    block_kick.Init(SAMPLE_RATE);
+
+    size_t next = 0;
+    for(size_t i = 0; i < BLOCK_SIZE * NUM_BLOCKS; i++)
+    {
+        bool trigger = false;
+        while(next < DSY_COUNTOF(triggers) && triggers[next] == i)
+        {
+            trigger = true;
+            next++;
+        }
+        sample_out[i] = sample_kick.Process(trigger);
+    }
+
+    /* all events are added up front and carried from block to block */
+    EventList<8> events;
+    for(size_t i = 0; i < DSY_COUNTOF(triggers); i++)
+    {
+        events.Add(triggers[i], BlockEvent::TRIGGER);
+    }
+    events.Add(300, BlockEvent::GATE_ON);
+    for(size_t b = 0; b < NUM_BLOCKS; b++)
+    {
+        RenderTriggered(
+            block_kick, events, block_out + b * BLOCK_SIZE, BLOCK_SIZE);
+        events.Advance(BLOCK_SIZE);
+    }
+
+    bool pass = events.GetCount() == 0;
+    for(size_t i = 0; i < BLOCK_SIZE * NUM_BLOCKS; i++)
+    {
+        pass &= block_out[i] == sample_out[i];
+    }
+    return pass;
+}
+
+/** Gate events open and close an envelope at the same samples as a
+ ** Process() loop, and the gate carries over block boundaries */
+static bool render_gated()
+{
+    Adsr sample_env, block_env;
+    sample_env.Init(SAMPLE_RATE);
+    block_env.Init(SAMPLE_RATE);
+    sample_env.SetTime(ADSR_SEG_ATTACK, 0.001f);
+    block_env.SetTime(ADSR_SEG_ATTACK, 0.001f);
+
+    for(size_t i = 0; i < BLOCK_SIZE * NUM_BLOCKS; i++)
+    {
+        const bool gate = (i >= 10 && i < 130) || (i >= 300 && i < 301);
+        sample_out[i]   = sample_env.Process(gate);
+    }
+
+    EventList<8> events;
+    events.Add(10, BlockEvent::GATE_ON);
+    events.Add(130, BlockEvent::GATE_OFF);
+    events.Add(300, BlockEvent::GATE_ON);
+    events.Add(301, BlockEvent::GATE_OFF);
+    events.Add(200, BlockEvent::TRIGGER);
+
+    bool gate = false;
+    for(size_t b = 0; b < NUM_BLOCKS; b++)
+    {
+        RenderGated(
+            block_env, gate, events, block_out + b * BLOCK_SIZE, BLOCK_SIZE);
+        events.Advance(BLOCK_SIZE);
+    }
+
+    bool pass = !gate && events.GetCount() == 0;
+    for(size_t i = 0; i < BLOCK_SIZE * NUM_BLOCKS; i++)
+    {
+        pass &= block_out[i] == sample_out[i];
+    }
+    return pass;
+}
+
+struct EventCase
+{
+    const char* name;
+    bool (*test)();
+};
+
+static const EventCase case_list[] = {
+    {"Add sorted", add_sorted},
+    {"Same offset", same_offset},
+    {"Remove", remove_events},
+    {"Advance carry", advance_carry},
+    {"Render triggered", render_triggered},
+    {"Render gated", render_gated},
+};
+
+
+int main(void)
+{
+    /* Initialize hardware */
+    hw.Prepare();
+
+    /* Print header */
+    hw.PrintLine("Case              | Check");
+
+    bool result = true;
+    for(size_t i = 0; i < DSY_COUNTOF(case_list); i++)
+    {
+        const bool pass = case_list[i].test();
+        hw.PrintLine("%-18s| %s", case_list[i].name, hw.ResultStr(pass));
+        result &= pass;
+    }
+
+    /* Display the result */
+    hw.Finish(result);
+    return result ? 0 : -1;
+}
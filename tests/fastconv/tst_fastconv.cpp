@@ -0,0 +1,143 @@
+#include "daisysp.h"
+#include "test_util.h"
+
+#if defined(_WIN32)
+
+#else
+#include "util/scopedirqblocker.h"
+#endif
+
+/**   @brief FastConv unit tests / benchmarks against the direct form FIR
+ */
+
+using namespace daisysp;
+using namespace daisy;
+
+
+/** Test platform choice, DaisySeed, DaisyPod and DaisyPC are currently supported 
+ ** If compiled for a PC target, all platforms would automagically turn into 
+ ** DaisyPC */
+using TestPlatform = DsyTestHelper<DaisyPod>;
+static TestPlatform hw;
+
+
+/* Test cases */
+static constexpr size_t filter_list[] = {64, 65, 256, 1000, 1024, 4096};
+static constexpr size_t block_list[]  = {1, 7, 48, 64, 300};
+
+/* Success criterion (FFT rounding, not bit-exact) */
+static constexpr float ERROR_THRESH_DB = -80.0f;
+
+/* Compile-time bounds */
+static constexpr size_t MAX_IR_LENGTH = TestPlatform::FindMax(filter_list);
+static constexpr size_t MAX_BLOCK_SZ  = TestPlatform::FindMax(block_list);
+static constexpr size_t SIGNAL_LENGTH = 16384;
+
+/* Memory buffers */
+static float DSY_SDRAM_BSS data_in[SIGNAL_LENGTH];
+static float DSY_SDRAM_BSS data_out[SIGNAL_LENGTH];
+static float DSY_SDRAM_BSS data_ref[SIGNAL_LENGTH];
+static float DSY_SDRAM_BSS data_ir[MAX_IR_LENGTH];
+
+/* Filters under test, large enough for the longest response */
+static FIRFilterImplGeneric<MAX_IR_LENGTH, MAX_BLOCK_SZ> DSY_SDRAM_BSS REF;
+static FastConv<MAX_IR_LENGTH> DSY_SDRAM_BSS DUT;
+
+/** Helper function to apply a given filter, returns the time in ticks */
+template <class dut_type>
+static uint32_t apply(dut_type& DUT,
+                      const float* __restrict pFilter,
+                      float* __restrict pSrc,
+                      float* __restrict pDst,
+                      size_t filter_length,
+                      size_t signal_length,
+                      size_t block_size)
+{
+    /* configure impulse response */
+    DUT.SetIR(pFilter, filter_length, false);
+
+    /* disable interrupts for the duration of measurements */
+    ScopedIrqBlocker block;
+    const uint32_t   t0 = hw.GetSeed().system.GetTick();
+
+    if(block_size == 1)
+    {
+        for(size_t i = 0; i < signal_length; i++)
+        {
+            pDst[i] = DUT.Process(pSrc[i]); /*< process sample by sample */
+        }
+    }
+    else
+    {
+        while(signal_length > 0)
+        {
+            const size_t size = DSY_MIN(signal_length, block_size);
+            DUT.ProcessBlock(pSrc, pDst, size);
+            signal_length -= size;
+            pSrc += size;
+            pDst += size;
+        }
+    }
+
+    return hw.GetSeed().system.GetTick() - t0;
+}
+
+static bool verify_single(size_t filter_length, size_t block_size)
+{
+    /* regenerate input signal every time for some random variation */
+    hw.GenerateSignal(data_in, SIGNAL_LENGTH);
+
+    const float tick_freq = 2.0e-6f * hw.GetSeed().system.GetPClk1Freq();
+    const float per_scale = 1.0f / (tick_freq * SIGNAL_LENGTH);
+
+    /* the head of data_ir is used, tail-first */
+    const float*   ir     = data_ir + MAX_IR_LENGTH - filter_length;
+    const uint32_t ref_dt = apply(
+        REF, ir, data_in, data_ref, filter_length, SIGNAL_LENGTH, block_size);
+    const uint32_t dut_dt = apply(
+        DUT, ir, data_in, data_out, filter_length, SIGNAL_LENGTH, block_size);
+    const float rms = hw.CalcMSEdB(data_ref, data_out, SIGNAL_LENGTH);
+
+    const bool pass = rms < ERROR_THRESH_DB;
+
+    hw.PrintLine("%5u |%6u |" FLT_FMT3 "|" FLT_FMT3 "|" FLT_FMT3 "| %s",
+                 filter_length,
+                 block_size,
+                 FLT_VAR3(rms),
+                 FLT_VAR3(per_scale * ref_dt),
+                 FLT_VAR3(per_scale * dut_dt),
+                 hw.ResultStr(pass));
+
+    return pass;
+}
+
+
+int main(void)
+{
+    /* Initialize hardware */
+    hw.Prepare();
+
+    /* Randomize impulse response, scaled down to keep the output in range */
+    hw.GenerateSignal(data_ir, DSY_COUNTOF(data_ir));
+    for(size_t i = 0; i < DSY_COUNTOF(data_ir); i++)
+    {
+        data_ir[i] *= 0.05f;
+    }
+
+    /* Print header */
+    hw.PrintLine("Filter| Proc  |  RMS   | Time [us/smp]  |");
+    hw.PrintLine(" Size | Block | Error  |   FIR  |FastConv| Check");
+
+    bool result = true;
+    for(size_t i = 0; i < DSY_COUNTOF(filter_list); i++)
+    {
+        for(size_t j = 0; j < DSY_COUNTOF(block_list); j++)
+        {
+            result &= verify_single(filter_list[i], block_list[j]);
+        }
+    }
+
+    /* Display the result */
+    hw.Finish(result);
+    return result ? 0 : -1;
+}
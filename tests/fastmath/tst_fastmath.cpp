@@ -0,0 +1,219 @@
+#include "daisysp.h"
+#include "test_util.h"
+
+#if defined(_WIN32)
+
+#else
+#include "util/scopedirqblocker.h"
+#endif
+
+/**   @brief Fast math kernel unit tests / benchmarks against libm
+ */
+
+using namespace daisysp;
+using namespace daisy;
+
+
+/** Test platform choice, DaisySeed, DaisyPod and DaisyPC are currently supported 
+ ** If compiled for a PC target, all platforms would automagically turn into 
+ ** DaisyPC */
+using TestPlatform = DsyTestHelper<DaisyPod>;
+static TestPlatform hw;
+
+
+/* Not a multiple of the vector width, so the scalar tail runs as well */
+static constexpr size_t SIGNAL_LENGTH = 4099;
+
+/* Memory buffers */
+static float DSY_SDRAM_BSS data_in[SIGNAL_LENGTH];
+static float DSY_SDRAM_BSS data_out[SIGNAL_LENGTH];
+static float DSY_SDRAM_BSS data_ref[SIGNAL_LENGTH];
+
+/* Double precision references */
+static double ref_sin2pi(double x)
+{
+    return sin(6.283185307179586 * x);
+}
+static double ref_softclip(double x)
+{
+    return SoftClip(static_cast<float>(x));
+}
+static double ref_mtof(double x)
+{
+    return 440.0 * exp2((x - 69.0) / 12.0);
+}
+static double ref_dbtogain(double x)
+{
+    return pow(10.0, x / 20.0);
+}
+static double ref_gaintodb(double x)
+{
+    return 20.0 * log10(x);
+}
+
+/* Single precision libm counterparts for timing */
+static float lib_sin2pi(float x)
+{
+    return sinf(TWOPI_F * x);
+}
+static float lib_mtof(float x)
+{
+    return powf(2.0f, (x - 69.0f) / 12.0f) * 440.0f;
+}
+static float lib_dbtogain(float x)
+{
+    return powf(10.0f, x * 0.05f);
+}
+static float lib_gaintodb(float x)
+{
+    return 20.0f * log10f(x);
+}
+
+/** Test case, the error is relative when rel is set, absolute otherwise */
+struct FastMathCase
+{
+    const char* name;
+    void (*kernel)(const float*, float*, size_t);
+    float (*libm)(float);
+    double (*ref)(double);
+    float lo;
+    float hi;
+    bool  log_spaced;
+    bool  rel;
+    float max_error;
+};
+
+/* Domains and bounds as documented in dsp.h, with a little margin */
+static const FastMathCase case_list[] = {
+    {"Exp2", simd::Exp2, exp2f, exp2, -126.0f, 127.0f, false, true, 1.5e-7f},
+    {"Log2", simd::Log2, log2f, log2, 0.5f, 2.0f, false, false, 2.0e-7f},
+    {"Exp", simd::Exp, expf, exp, -10.0f, 10.0f, false, true, 1.0e-6f},
+    {"Tanh", simd::Tanh, tanhf, tanh, -12.0f, 12.0f, false, false, 3.0e-7f},
+    {"Sin2Pi",
+     simd::Sin2Pi,
+     lib_sin2pi,
+     ref_sin2pi,
+     -1000.0f,
+     1000.0f,
+     false,
+     false,
+     3.0e-7f},
+    {"Sin", simd::Sin, sinf, sin, -TWOPI_F, TWOPI_F, false, false, 1.0e-6f},
+    {"Cos", simd::Cos, cosf, cos, -TWOPI_F, TWOPI_F, false, false, 1.0e-6f},
+    {"Tan", simd::Tan, tanf, tan, -1.5f, 1.5f, false, true, 4.0e-6f},
+    {"SoftClip",
+     simd::SoftClip,
+     SoftClip,
+     ref_softclip,
+     -5.0f,
+     5.0f,
+     false,
+     false,
+     3.0e-7f},
+    {"Mtof", simd::Mtof, lib_mtof, ref_mtof, -20.0f, 150.0f, false, true, 8.0e-7f},
+    {"DbToGain",
+     simd::DbToGain,
+     lib_dbtogain,
+     ref_dbtogain,
+     -140.0f,
+     40.0f,
+     false,
+     true,
+     1.0e-6f},
+    {"GainToDb",
+     simd::GainToDb,
+     lib_gaintodb,
+     ref_gaintodb,
+     1.0e-6f,
+     10.0f,
+     true,
+     false,
+     1.5e-5f},
+};
+
+/** Helper function to time the libm function, returns the time in ticks */
+static uint32_t apply_libm(float (*fn)(float))
+{
+    /* disable interrupts for the duration of measurements */
+    ScopedIrqBlocker block;
+    const uint32_t   t0 = hw.GetSeed().system.GetTick();
+
+    for(size_t i = 0; i < SIGNAL_LENGTH; i++)
+    {
+        data_ref[i] = fn(data_in[i]);
+    }
+
+    return hw.GetSeed().system.GetTick() - t0;
+}
+
+/** Helper function to time the array kernel, returns the time in ticks */
+static uint32_t apply_kernel(void (*kernel)(const float*, float*, size_t))
+{
+    ScopedIrqBlocker block;
+    const uint32_t   t0 = hw.GetSeed().system.GetTick();
+
+    kernel(data_in, data_out, SIGNAL_LENGTH);
+
+    return hw.GetSeed().system.GetTick() - t0;
+}
+
+static bool verify_single(const FastMathCase& c)
+{
+    /* sweep the domain, endpoints included */
+    for(size_t i = 0; i < SIGNAL_LENGTH; i++)
+    {
+        const float t = static_cast<float>(i) / (SIGNAL_LENGTH - 1);
+        data_in[i]    = c.log_spaced ? c.lo * powf(c.hi / c.lo, t)
+                                     : c.lo + (c.hi - c.lo) * t;
+    }
+
+    const float tick_freq = 2.0e-6f * hw.GetSeed().system.GetPClk1Freq();
+    const float per_scale = 1.0f / (tick_freq * SIGNAL_LENGTH);
+
+    const uint32_t ref_dt = apply_libm(c.libm);
+    const uint32_t dut_dt = apply_kernel(c.kernel);
+
+    bool   pass      = true;
+    double max_error = 0.0;
+    for(size_t i = 0; i < SIGNAL_LENGTH; i++)
+    {
+        const double ref   = c.ref(data_in[i]);
+        double       error = fabs(data_out[i] - ref);
+        if(c.rel)
+        {
+            error /= fabs(ref);
+        }
+        max_error = DSY_MAX(max_error, error);
+    }
+    pass &= max_error < c.max_error;
+
+    hw.PrintLine("%-9s|" FLT_FMT3 "|" FLT_FMT3 "|" FLT_FMT3 "| %s",
+                 c.name,
+                 FLT_VAR3(1.0e6f * static_cast<float>(max_error)),
+                 FLT_VAR3(per_scale * ref_dt),
+                 FLT_VAR3(per_scale * dut_dt),
+                 hw.ResultStr(pass));
+
+    return pass;
+}
+
+
+int main(void)
+{
+    /* Initialize hardware */
+    hw.Prepare();
+
+    /* Print header */
+    hw.PrintLine("         |  Max   | Time [us/smp]  |");
+    hw.PrintLine("Kernel   | Err e-6|  libm  | simd   | Check");
+
+    bool result = true;
+    for(size_t i = 0; i < DSY_COUNTOF(case_list); i++)
+    {
+        result &= verify_single(case_list[i]);
+    }
+
+    /* Display the result */
+    hw.Finish(result);
+    return result ? 0 : -1;
+}
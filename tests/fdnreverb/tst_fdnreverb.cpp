@@ -0,0 +1,147 @@
+#include "daisysp.h"
+#include "test_util.h"
+
+/**   @brief FdnReverb checks, ProcessBlock() against Process()
+ */
+
+using namespace daisysp;
+using namespace daisy;
+
+
+/** Test platform choice, DaisySeed, DaisyPod and DaisyPC are currently supported
+ ** If compiled for a PC target, all platforms would automagically turn into
+ ** DaisyPC */
+using TestPlatform = DsyTestHelper<DaisyPod>;
+static TestPlatform hw;
+
+
+static constexpr float  SAMPLE_RATE   = 48000.0f;
+static constexpr size_t MEMORY_SIZE   = 128 * 1024;
+static constexpr size_t SIGNAL_LENGTH = 9600;
+
+/* Block sizes cycled through, short ones take the per sample path */
+static const size_t block_sizes[] = {48, 1, 7, 64, 13, 100, 8, 5, 47};
+
+/* Delay memory of the two reverbs, and their output */
+static float DSY_SDRAM_BSS memory[2][MEMORY_SIZE];
+static float DSY_SDRAM_BSS data_in[2][SIGNAL_LENGTH];
+static float DSY_SDRAM_BSS data_ref[2][SIGNAL_LENGTH];
+static float DSY_SDRAM_BSS data_out[2][SIGNAL_LENGTH];
+
+/** A noise burst followed by silence, so the tail is compared too */
+static void MakeInput()
+{
+    Random rng;
+    for(size_t i = 0; i < SIGNAL_LENGTH; i++)
+    {
+        const bool burst = i < SIGNAL_LENGTH / 8;
+        data_in[0][i]    = burst ? rng.NextBipolar() : 0.0f;
+        data_in[1][i]    = burst ? rng.NextBipolar() : 0.0f;
+    }
+}
+
+/** ProcessBlock() in blocks of every size gives the same samples as
+ ** Process() */
+template <size_t num_lines>
+static bool block_matches(uint8_t matrix)
+{
+    static FdnReverb<num_lines> ref, verb;
+    const size_t size = FdnReverb<num_lines>::GetBufferSize(SAMPLE_RATE);
+    if(size > MEMORY_SIZE || !ref.Init(SAMPLE_RATE, memory[0], size)
+       || !verb.Init(SAMPLE_RATE, memory[1], size))
+        return false;
+    ref.SetMatrix(matrix);
+    verb.SetMatrix(matrix);
+    ref.SetFeedback(0.95f);
+    verb.SetFeedback(0.95f);
+    ref.SetLpFreq(6000.0f);
+    verb.SetLpFreq(6000.0f);
+
+    for(size_t i = 0; i < SIGNAL_LENGTH; i++)
+    {
+        ref.Process(
+            data_in[0][i], data_in[1][i], &data_ref[0][i], &data_ref[1][i]);
+    }
+    for(size_t i = 0, b = 0; i < SIGNAL_LENGTH; b++)
+    {
+        const size_t todo = DSY_MIN(block_sizes[b % DSY_COUNTOF(block_sizes)],
+                                    SIGNAL_LENGTH - i);
+        verb.ProcessBlock(data_in[0] + i,
+                          data_in[1] + i,
+                          data_out[0] + i,
+                          data_out[1] + i,
+                          todo);
+        i += todo;
+    }
+
+    bool pass = true;
+    for(size_t i = 0; i < SIGNAL_LENGTH; i++)
+    {
+        pass &= data_out[0][i] == data_ref[0][i];
+        pass &= data_out[1][i] == data_ref[1][i];
+    }
+    /* the tail must not have died out, or the check proves little */
+    pass &= data_ref[0][SIGNAL_LENGTH - 1] != 0.0f;
+    return pass;
+}
+
+/** A buffer one sample short fails Init() and leaves no lines behind */
+static bool init_too_small()
+{
+    static FdnReverb<8> verb;
+    const size_t        size = FdnReverb<8>::GetBufferSize(SAMPLE_RATE);
+
+    bool pass = !verb.Init(SAMPLE_RATE, memory[0], size - 1);
+    pass &= !verb.Init(SAMPLE_RATE, nullptr, size);
+    for(size_t n = 0; n < 8; n++)
+    {
+        pass &= verb.GetLineLength(n) == 0;
+    }
+    pass &= verb.Init(SAMPLE_RATE, memory[0], size);
+    pass &= verb.GetLineLength(7) > verb.GetLineLength(0);
+    return pass;
+}
+
+struct ReverbCase
+{
+    const char* name;
+    uint8_t     matrix;
+    bool (*test)(uint8_t matrix);
+};
+
+static const ReverbCase case_list[] = {
+    {"4 Hadamard", FdnReverb<4>::MATRIX_HADAMARD, block_matches<4>},
+    {"8 Hadamard", FdnReverb<8>::MATRIX_HADAMARD, block_matches<8>},
+    {"16 Hadamard", FdnReverb<16>::MATRIX_HADAMARD, block_matches<16>},
+    {"32 Hadamard", FdnReverb<32>::MATRIX_HADAMARD, block_matches<32>},
+    {"4 Householder", FdnReverb<4>::MATRIX_HOUSEHOLDER, block_matches<4>},
+    {"8 Householder", FdnReverb<8>::MATRIX_HOUSEHOLDER, block_matches<8>},
+    {"16 Householder", FdnReverb<16>::MATRIX_HOUSEHOLDER, block_matches<16>},
+    {"32 Householder", FdnReverb<32>::MATRIX_HOUSEHOLDER, block_matches<32>},
+};
+
+
+int main(void)
+{
+    /* Initialize hardware */
+    hw.Prepare();
+    MakeInput();
+
+    /* Print header */
+    hw.PrintLine("Case              | Check");
+
+    bool result = true;
+    for(size_t i = 0; i < DSY_COUNTOF(case_list); i++)
+    {
+        const bool pass = case_list[i].test(case_list[i].matrix);
+        hw.PrintLine("%-18s| %s", case_list[i].name, hw.ResultStr(pass));
+        result &= pass;
+    }
+    const bool pass = init_too_small();
+    hw.PrintLine("%-18s| %s", "Init too small", hw.ResultStr(pass));
+    result &= pass;
+
+    /* Display the result */
+    hw.Finish(result);
+    return result ? 0 : -1;
+}
@@ -0,0 +1,129 @@
+#include "daisysp.h"
+#include "test_util.h"
+
+/**   @brief OscillatorArray checks against Oscillator, for every waveform
+ */
+
+using namespace daisysp;
+using namespace daisy;
+
+
+/** Test platform choice, DaisySeed, DaisyPod and DaisyPC are currently supported
+ ** If compiled for a PC target, all platforms would automagically turn into
+ ** DaisyPC */
+using TestPlatform = DsyTestHelper<DaisyPod>;
+static TestPlatform hw;
+
+
+static constexpr float  SAMPLE_RATE   = 48000.0f;
+static constexpr size_t NUM_VOICES    = 4;
+static constexpr size_t SIGNAL_LENGTH = 2400;
+
+static const float voice_freq[NUM_VOICES] = {110.0f, 220.0f, 440.0f, 1000.0f};
+
+/* Memory buffers, interleaved frames like OscillatorArray::Render() */
+static float DSY_SDRAM_BSS data_out[SIGNAL_LENGTH * NUM_VOICES];
+static float DSY_SDRAM_BSS data_ref[SIGNAL_LENGTH * NUM_VOICES];
+
+/** Test case. Naive waveforms jump where the phase wraps, and the phase of
+ ** Oscillator is in radians, so a jump may land one sample earlier or later:
+ ** samples next to a jump of the reference are not compared for those. */
+struct OscillatorCase
+{
+    const char* name;
+    uint8_t     waveform;
+    bool        skip_jumps;
+    size_t      skip_start;
+    float       max_error;
+};
+
+static const OscillatorCase case_list[] = {
+    {"Sin", Oscillator::WAVE_SIN, false, 0, 1.0e-3f},
+    {"Tri", Oscillator::WAVE_TRI, false, 0, 1.0e-3f},
+    {"Saw", Oscillator::WAVE_SAW, true, 0, 1.0e-3f},
+    {"Ramp", Oscillator::WAVE_RAMP, true, 0, 1.0e-3f},
+    {"Square", Oscillator::WAVE_SQUARE, true, 0, 1.0e-3f},
+    {"BlepTri", Oscillator::WAVE_POLYBLEP_TRI, false, 0, 2.0e-3f},
+    /* the two sample BLEPs differ only on the first sample */
+    {"BlepSaw", Oscillator::WAVE_POLYBLEP_SAW, false, 1, 8.0e-3f},
+    {"BlepSq", Oscillator::WAVE_POLYBLEP_SQUARE, false, 1, 8.0e-3f},
+};
+
+static bool IsNearJump(size_t i, size_t voice)
+{
+    const float* ref  = data_ref + voice;
+    const size_t last = SIGNAL_LENGTH - 1;
+    return (i > 0
+            && fabsf(ref[i * NUM_VOICES] - ref[(i - 1) * NUM_VOICES]) > 1.0f)
+           || (i < last
+               && fabsf(ref[(i + 1) * NUM_VOICES] - ref[i * NUM_VOICES])
+                      > 1.0f);
+}
+
+static bool verify_single(const OscillatorCase& c)
+{
+    OscillatorArray<NUM_VOICES> array;
+    array.Init(SAMPLE_RATE);
+    array.SetWaveform(c.waveform);
+    array.SetAmp(1.0f);
+    for(size_t v = 0; v < NUM_VOICES; v++)
+    {
+        Oscillator osc;
+        osc.Init(SAMPLE_RATE);
+        osc.SetWaveform(c.waveform);
+        osc.SetFreq(voice_freq[v]);
+        osc.SetAmp(1.0f);
+        for(size_t i = 0; i < SIGNAL_LENGTH; i++)
+        {
+            data_ref[i * NUM_VOICES + v] = osc.Process();
+        }
+        array.SetFreq(v, voice_freq[v]);
+    }
+    array.Render(data_out, SIGNAL_LENGTH);
+
+    float  max_error = 0.0f;
+    size_t skipped   = 0;
+    for(size_t v = 0; v < NUM_VOICES; v++)
+    {
+        for(size_t i = c.skip_start; i < SIGNAL_LENGTH; i++)
+        {
+            if(c.skip_jumps && IsNearJump(i, v))
+            {
+                skipped++;
+                continue;
+            }
+            const size_t idx = i * NUM_VOICES + v;
+            max_error = DSY_MAX(max_error, fabsf(data_out[idx] - data_ref[idx]));
+        }
+    }
+    const bool pass = max_error < c.max_error;
+
+    hw.PrintLine("%-8s|" FLT_FMT3 "| %5u | %s",
+                 c.name,
+                 FLT_VAR3(1.0e3f * max_error),
+                 static_cast<unsigned>(skipped),
+                 hw.ResultStr(pass));
+
+    return pass;
+}
+
+
+int main(void)
+{
+    /* Initialize hardware */
+    hw.Prepare();
+
+    /* Print header */
+    hw.PrintLine("        |  Max   |       |");
+    hw.PrintLine("Waveform| Err e-3|Skipped| Check");
+
+    bool result = true;
+    for(size_t i = 0; i < DSY_COUNTOF(case_list); i++)
+    {
+        result &= verify_single(case_list[i]);
+    }
+
+    /* Display the result */
+    hw.Finish(result);
+    return result ? 0 : -1;
+}
@@ -0,0 +1,220 @@
+#include "daisysp.h"
+#include "test_util.h"
+
+#if defined(_WIN32)
+#include <thread>
+#endif
+
+/**   @brief ParameterQueue and ParameterSet unit tests
+ */
+
+using namespace daisysp;
+using namespace daisy;
+
+
+/** Test platform choice, DaisySeed, DaisyPod and DaisyPC are currently supported
+ ** If compiled for a PC target, all platforms would automagically turn into
+ ** DaisyPC */
+using TestPlatform = DsyTestHelper<DaisyPod>;
+static TestPlatform hw;
+
+
+enum
+{
+    FREQ,
+    RES,
+    NUM_PARAMS
+};
+
+static ParameterChange Change(uint32_t id, float value)
+{
+    ParameterChange change;
+    change.id    = id;
+    change.time  = 0;
+    change.value = value;
+    change.timed = false;
+    return change;
+}
+
+/** Changes come out in the order they went in, a full queue refuses more
+ ** and the indices wrap around */
+static bool queue_order()
+{
+    ParameterQueue<8> queue;
+    queue.Init();
+
+    bool            pass = true;
+    ParameterChange change;
+    pass &= !queue.Peek(change) && !queue.Pop(change);
+    for(uint32_t round = 0; round < 5; round++)
+    {
+        for(uint32_t i = 0; i < 8; i++)
+        {
+            pass &= queue.Push(Change(i, round * 8.f + i));
+        }
+        pass &= !queue.Push(Change(8, 0.f));
+        pass &= queue.GetCount() == 8;
+
+        /* drain all but three, so the next round wraps */
+        for(uint32_t i = 0; i < 5; i++)
+        {
+            pass &= queue.Peek(change) && change.id == i;
+            pass &= queue.Pop(change) && change.value == round * 8.f + i;
+        }
+        for(uint32_t i = 5; i < 8; i++)
+        {
+            pass &= queue.Pop(change) && change.id == i;
+        }
+        pass &= queue.GetCount() == 0 && !queue.Pop(change);
+    }
+    return pass;
+}
+
+/** A timed change splits the block at its time and applies there */
+static bool set_timed()
+{
+    ParameterSet<NUM_PARAMS, 8> params;
+    params.Init(1.f);
+
+    bool pass = params.Update(48) == 48 && params.GetTime() == 0;
+    pass &= params.Set(FREQ, 2.f, 48 + 10);
+    pass &= params.Set(RES, 3.f, 48 + 30);
+
+    pass &= params.Update(48) == 10 && params.Get(FREQ) == 1.f;
+    pass &= params.GetTime() == 48;
+    pass &= params.Update(38) == 20 && params.Get(FREQ) == 2.f;
+    pass &= params.Get(RES) == 1.f && params.GetTime() == 58;
+    pass &= params.Update(18) == 18 && params.Get(RES) == 3.f;
+    pass &= params.GetTime() == 78;
+
+    /* a change for a time that has passed applies at once */
+    pass &= params.Set(FREQ, 4.f, 50);
+    pass &= params.Update(48) == 48 && params.Get(FREQ) == 4.f;
+    pass &= !params.Set(NUM_PARAMS, 0.f);
+    return pass;
+}
+
+/** An untimed change does not wait behind a timed one that is not due */
+static bool set_untimed()
+{
+    ParameterSet<NUM_PARAMS, 8> params;
+    params.Init(1.f);
+
+    bool pass = params.Set(FREQ, 2.f, 10000);
+    pass &= params.Set(RES, 3.f);
+
+    pass &= params.Update(48) == 48;
+    pass &= params.Get(RES) == 3.f && params.Get(FREQ) == 1.f;
+
+    pass &= params.Set(RES, 4.f);
+    pass &= params.Update(48) == 48 && params.Get(RES) == 4.f;
+
+    /* the timed change still comes at its time */
+    size_t n;
+    do
+    {
+        pass &= params.Get(FREQ) == 1.f;
+        n = params.Update(48);
+    } while(n == 48);
+    pass &= params.GetTime() + n == 10000;
+    pass &= params.Update(48) == 48 && params.Get(FREQ) == 2.f;
+    return pass;
+}
+
+/** Changes due in the same Update() apply in the order they were set */
+static bool set_same_update()
+{
+    ParameterSet<NUM_PARAMS, 8> params;
+    params.Init(0.f);
+
+    bool pass = params.Set(FREQ, 1.f);
+    pass &= params.Set(FREQ, 2.f, 0);
+    pass &= params.Set(RES, 3.f, 0);
+    pass &= params.Set(RES, 4.f);
+    pass &= params.Update(48) == 48;
+    pass &= params.Get(FREQ) == 2.f && params.Get(RES) == 4.f;
+
+    /* each kind has its own capacity */
+    for(size_t i = 0; i < 8; i++)
+    {
+        pass &= params.Set(FREQ, 5.f) && params.Set(RES, 6.f, 0);
+    }
+    pass &= !params.Set(FREQ, 7.f) && !params.Set(RES, 7.f, 0);
+    pass &= params.Update(48) == 48;
+    pass &= params.Get(FREQ) == 5.f && params.Get(RES) == 6.f;
+    return pass;
+}
+
+#if defined(_WIN32)
+/** A control thread sets a counting value while the audio thread updates,
+ ** every value arrives and in order */
+static bool set_threads()
+{
+    static constexpr uint32_t kChanges = 100000;
+
+    static ParameterSet<NUM_PARAMS, 16> params;
+    params.Init(0.f);
+
+    std::thread control([]() {
+        for(uint32_t i = 1; i <= kChanges; i++)
+        {
+            while(!params.Set(i % 2 ? FREQ : RES, static_cast<float>(i)))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    bool  pass = true;
+    float last = 0.f;
+    while(last < kChanges)
+    {
+        params.Update(48);
+        const float value = DSY_MAX(params.Get(FREQ), params.Get(RES));
+        pass &= value >= last;
+        last = value;
+    }
+    control.join();
+    pass &= params.Get(FREQ) == kChanges - 1 && params.Get(RES) == kChanges;
+    return pass;
+}
+#endif
+
+struct ParameterCase
+{
+    const char* name;
+    bool (*test)();
+};
+
+static const ParameterCase case_list[] = {
+    {"Queue order", queue_order},
+    {"Set timed", set_timed},
+    {"Set untimed", set_untimed},
+    {"Set same update", set_same_update},
+#if defined(_WIN32)
+    /* the Daisy targets have no threads */
+    {"Set threads", set_threads},
+#endif
+};
+
+
+int main(void)
+{
+    /* Initialize hardware */
+    hw.Prepare();
+
+    /* Print header */
+    hw.PrintLine("Case              | Check");
+
+    bool result = true;
+    for(size_t i = 0; i < DSY_COUNTOF(case_list); i++)
+    {
+        const bool pass = case_list[i].test();
+        hw.PrintLine("%-18s| %s", case_list[i].name, hw.ResultStr(pass));
+        result &= pass;
+    }
+
+    /* Display the result */
+    hw.Finish(result);
+    return result ? 0 : -1;
+}
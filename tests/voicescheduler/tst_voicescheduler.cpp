@@ -0,0 +1,158 @@
+#include "daisysp.h"
+#include "test_util.h"
+
+#if defined(_WIN32)
+#include "Utility/voicescheduler.h"
+#endif
+
+/**   @brief VoiceScheduler unit tests
+ */
+
+using namespace daisysp;
+using namespace daisy;
+
+
+/** Test platform choice, DaisySeed, DaisyPod and DaisyPC are currently supported
+ ** If compiled for a PC target, all platforms would automagically turn into
+ ** DaisyPC */
+using TestPlatform = DsyTestHelper<DaisyPod>;
+static TestPlatform hw;
+
+
+#if defined(_WIN32)
+static constexpr float  SAMPLE_RATE   = 48000.0f;
+static constexpr size_t NUM_VOICES    = 12;
+static constexpr size_t SIGNAL_LENGTH = 4800;
+
+/* Block sizes cycled through, longer than the scheduler's 48 sample
+   blocks too */
+static const size_t block_sizes[] = {48, 100, 1, 31, 256, 7};
+
+static StringVoice voices[NUM_VOICES];
+static float       data_ref[SIGNAL_LENGTH];
+static float       data_out[SIGNAL_LENGTH];
+
+/** Starts every voice from the same state, each with its own pitch and
+ ** seed, and strikes it */
+static void InitVoices()
+{
+    for(size_t v = 0; v < NUM_VOICES; v++)
+    {
+        voices[v].SetSeed(static_cast<uint32_t>(v * 3));
+        voices[v].Init(SAMPLE_RATE);
+        voices[v].SetFreq(80.0f * (1.0f + 0.37f * v));
+        voices[v].SetBrightness(0.1f + 0.07f * v);
+        voices[v].SetSustain(v % 4 == 3);
+        voices[v].Trig();
+    }
+}
+
+/** The voices summed in the order they were added, one at a time */
+static void RenderReference()
+{
+    InitVoices();
+    for(size_t i = 0; i < SIGNAL_LENGTH; i++)
+    {
+        data_ref[i] = voices[0].Process();
+        for(size_t v = 1; v < NUM_VOICES; v++)
+        {
+            data_ref[i] += voices[v].Process();
+        }
+    }
+}
+
+/** The scheduler gives the reference samples, whatever the thread count */
+static bool same_output(size_t num_threads)
+{
+    static VoiceScheduler<NUM_VOICES> scheduler;
+
+    InitVoices();
+    scheduler.ClearVoices();
+    for(size_t v = 0; v < NUM_VOICES; v++)
+    {
+        scheduler.AddVoice(voices[v]);
+    }
+    bool pass = scheduler.Init(num_threads);
+    pass &= scheduler.GetNumThreads() == num_threads;
+
+    for(size_t i = 0, b = 0; i < SIGNAL_LENGTH; b++)
+    {
+        const size_t todo = DSY_MIN(block_sizes[b % DSY_COUNTOF(block_sizes)],
+                                    SIGNAL_LENGTH - i);
+        scheduler.Process(data_out + i, todo);
+        i += todo;
+    }
+    scheduler.Stop();
+
+    for(size_t i = 0; i < SIGNAL_LENGTH; i++)
+    {
+        pass &= data_out[i] == data_ref[i];
+    }
+    return pass;
+}
+
+/** No voices give silence, thread counts out of range are refused */
+static bool edge_cases()
+{
+    static VoiceScheduler<NUM_VOICES, 4> scheduler;
+
+    bool pass = !scheduler.Init(0) && !scheduler.Init(5);
+    pass &= scheduler.Init(4) && scheduler.GetNumVoices() == 0;
+    data_out[0] = data_out[99] = 1.0f;
+    scheduler.Process(data_out, 100);
+    pass &= data_out[0] == 0.0f && data_out[99] == 0.0f;
+    scheduler.Stop();
+    pass &= scheduler.GetNumThreads() == 1;
+    return pass;
+}
+
+struct SchedulerCase
+{
+    const char* name;
+    size_t      num_threads;
+};
+
+static const SchedulerCase case_list[] = {
+    {"1 thread", 1},
+    {"2 threads", 2},
+    {"3 threads", 3},
+    {"4 threads", 4},
+    {"8 threads", 8},
+};
+#endif
+
+
+int main(void)
+{
+    /* Initialize hardware */
+    hw.Prepare();
+
+    /* Print header */
+    hw.PrintLine("Case              | Check");
+
+    bool result = true;
+#if defined(_WIN32)
+    RenderReference();
+    for(size_t i = 0; i < DSY_COUNTOF(case_list); i++)
+    {
+        /* thread timing varies, so every count runs a few times */
+        bool pass = true;
+        for(size_t k = 0; k < 5; k++)
+        {
+            pass &= same_output(case_list[i].num_threads);
+        }
+        hw.PrintLine("%-18s| %s", case_list[i].name, hw.ResultStr(pass));
+        result &= pass;
+    }
+    const bool pass = edge_cases();
+    hw.PrintLine("%-18s| %s", "Edge cases", hw.ResultStr(pass));
+    result &= pass;
+#else
+    /* VoiceScheduler needs std::thread, the Daisy targets have none */
+    hw.PrintLine("No threads on this target, nothing to check");
+#endif
+
+    /* Display the result */
+    hw.Finish(result);
+    return result ? 0 : -1;
+}